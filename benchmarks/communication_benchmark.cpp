@@ -0,0 +1,385 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Latency and bandwidth benchmark of the communication formats
+// For each format two processes are launched, which exchange through the public interface:
+// - latency: ping-pong of an Info (ExportInfo / ImportInfo)
+// - bandwidth: ExportData from 8 bytes up to the maximum size, the receipt is acknowledged with an Info
+// - mesh: ExportMesh of structured quadrilateral meshes, the receipt is acknowledged with an Info
+// The results are written in JSON format
+// Usage: co_sim_io_communication_benchmark [output_file] [max_data_size_in_bytes] [communication_formats...]
+// The launched processes are called with: co_sim_io_communication_benchmark --run <a|b> <communication_format> <max_data_size_in_bytes> <result_file>
+
+// System includes
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+
+// Project includes
+#include "co_sim_io.hpp"
+#include "includes/utilities.hpp"
+
+#ifdef CO_SIM_IO_USING_MPI
+#include "co_sim_io_mpi.hpp"
+#endif
+
+namespace {
+
+constexpr int NUM_WARMUP_REPETITIONS = 10;
+constexpr int NUM_LATENCY_REPETITIONS = 1000;
+constexpr std::size_t MIN_DATA_SIZE = 8;
+constexpr std::size_t DATA_SIZE_FACTOR = 8;
+constexpr int NUM_MESH_REPETITIONS = 5;
+
+// the same number of repetitions is computed on both sides
+int NumDataRepetitions(const std::size_t DataSize)
+{
+    const std::size_t bytes_per_size = 256*1024*1024; // transferred in total for each size
+    return static_cast<int>(std::min(std::max(bytes_per_size/DataSize, static_cast<std::size_t>(3)), static_cast<std::size_t>(NUM_LATENCY_REPETITIONS)));
+}
+
+std::vector<std::size_t> GetDataSizes(const std::size_t MaxDataSize)
+{
+    std::vector<std::size_t> sizes;
+    for (std::size_t size=MIN_DATA_SIZE; size<=MaxDataSize; size*=DATA_SIZE_FACTOR) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+std::vector<std::size_t> GetMeshSizes()
+{
+    return {10, 100, 500}; // number of elements per direction
+}
+
+std::vector<std::string> GetAvailableCommunicationFormats()
+{
+    std::vector<std::string> formats {"file", "socket"};
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    formats.push_back("local_socket");
+    formats.push_back("pipe");
+    formats.push_back("shm");
+#endif
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+    formats.push_back("mpi_inter");
+#endif
+    return formats;
+}
+
+void CreateStructuredMesh(CoSimIO::ModelPart& rModelPart, const std::size_t NumElementsPerDirection)
+{
+    const std::size_t num_nodes_per_direction = NumElementsPerDirection+1;
+
+    for (std::size_t i=0; i<num_nodes_per_direction; ++i) {
+        for (std::size_t j=0; j<num_nodes_per_direction; ++j) {
+            rModelPart.CreateNewNode(i*num_nodes_per_direction+j+1, static_cast<double>(i), static_cast<double>(j), 0.0);
+        }
+    }
+
+    for (std::size_t i=0; i<NumElementsPerDirection; ++i) {
+        for (std::size_t j=0; j<NumElementsPerDirection; ++j) {
+            const CoSimIO::IdType id_1 = i*num_nodes_per_direction+j+1;
+            const CoSimIO::IdType id_2 = id_1+num_nodes_per_direction;
+            rModelPart.CreateNewElement(i*NumElementsPerDirection+j+1, CoSimIO::ElementType::Quadrilateral2D4, {id_1, id_2, id_2+1, id_1+1});
+        }
+    }
+}
+
+// writes the minimum, median and mean of the times as JSON members
+void WriteStatistics(std::ostream& rOStream, std::vector<double> Times)
+{
+    std::sort(Times.begin(), Times.end());
+    double sum = 0.0;
+    for (const double time : Times) {sum += time;}
+
+    rOStream << "\"min_time\": " << Times.front()
+             << ", \"median_time\": " << Times[Times.size()/2]
+             << ", \"mean_time\": " << sum/Times.size();
+}
+
+CoSimIO::Info CreateInfo(const std::string& rConnectionName, const std::string& rIdentifier)
+{
+    CoSimIO::Info info;
+    info.Set("connection_name", rConnectionName);
+    info.Set("identifier", rIdentifier);
+    return info;
+}
+
+// side "a" measures and writes the results, side "b" is the partner
+void RunLatency(const std::string& rConnectionName, const bool IsMeasuring, std::ostream& rOStream)
+{
+    const CoSimIO::Info info_ping = CreateInfo(rConnectionName, "ping");
+    const CoSimIO::Info info_pong = CreateInfo(rConnectionName, "pong");
+
+    std::vector<double> times;
+    for (int i=0; i<NUM_WARMUP_REPETITIONS+NUM_LATENCY_REPETITIONS; ++i) {
+        if (IsMeasuring) {
+            const auto start_time(std::chrono::steady_clock::now());
+            CoSimIO::ExportInfo(info_ping);
+            CoSimIO::ImportInfo(info_pong);
+            if (i >= NUM_WARMUP_REPETITIONS) {
+                times.push_back(CoSimIO::Utilities::ElapsedSeconds(start_time));
+            }
+        } else {
+            CoSimIO::ImportInfo(info_ping);
+            CoSimIO::ExportInfo(info_pong);
+        }
+    }
+
+    if (IsMeasuring) {
+        // the latency is half of the round trip time
+        for (double& r_time : times) {r_time /= 2;}
+        rOStream << "\"latency\": {\"num_repetitions\": " << NUM_LATENCY_REPETITIONS << ", ";
+        WriteStatistics(rOStream, times);
+        rOStream << "}";
+    }
+}
+
+void RunBandwidth(const std::string& rConnectionName, const bool IsMeasuring, const std::size_t MaxDataSize, std::ostream& rOStream)
+{
+    const CoSimIO::Info info_data = CreateInfo(rConnectionName, "data");
+    const CoSimIO::Info info_ack = CreateInfo(rConnectionName, "data_ack");
+
+    std::vector<double> data;
+    if (IsMeasuring) {
+        data.resize(MaxDataSize/sizeof(double), 1.5);
+        rOStream << "\"bandwidth\": [";
+    }
+
+    const std::vector<std::size_t> data_sizes = GetDataSizes(MaxDataSize);
+    for (std::size_t i_size=0; i_size<data_sizes.size(); ++i_size) {
+        const std::size_t data_size = data_sizes[i_size];
+        const int num_repetitions = NumDataRepetitions(data_size);
+
+        std::vector<double> times;
+        if (IsMeasuring) {
+            data.resize(data_size/sizeof(double));
+            for (int i=0; i<num_repetitions; ++i) {
+                const auto start_time(std::chrono::steady_clock::now());
+                CoSimIO::ExportData(info_data, data);
+                CoSimIO::ImportInfo(info_ack);
+                times.push_back(CoSimIO::Utilities::ElapsedSeconds(start_time));
+            }
+
+            const double min_time = *std::min_element(times.begin(), times.end());
+            rOStream << (i_size > 0 ? "," : "") << "\n        {\"size\": " << data_size << ", \"num_repetitions\": " << num_repetitions << ", ";
+            WriteStatistics(rOStream, times);
+            rOStream << ", \"bandwidth\": " << data_size/min_time << "}";
+        } else {
+            for (int i=0; i<num_repetitions; ++i) {
+                CoSimIO::ImportData(info_data, data);
+                CoSimIO::ExportInfo(info_ack);
+            }
+        }
+    }
+
+    if (IsMeasuring) {
+        rOStream << "]";
+    }
+}
+
+void RunMesh(const std::string& rConnectionName, const bool IsMeasuring, std::ostream& rOStream)
+{
+    const CoSimIO::Info info_mesh = CreateInfo(rConnectionName, "mesh");
+    const CoSimIO::Info info_ack = CreateInfo(rConnectionName, "mesh_ack");
+
+    if (IsMeasuring) {
+        rOStream << "\"mesh\": [";
+    }
+
+    const std::vector<std::size_t> mesh_sizes = GetMeshSizes();
+    for (std::size_t i_size=0; i_size<mesh_sizes.size(); ++i_size) {
+        CoSimIO::ModelPart model_part("benchmark");
+
+        std::vector<double> times;
+        if (IsMeasuring) {
+            CreateStructuredMesh(model_part, mesh_sizes[i_size]);
+            for (int i=0; i<NUM_MESH_REPETITIONS; ++i) {
+                const auto start_time(std::chrono::steady_clock::now());
+                CoSimIO::ExportMesh(info_mesh, model_part);
+                CoSimIO::ImportInfo(info_ack);
+                times.push_back(CoSimIO::Utilities::ElapsedSeconds(start_time));
+            }
+
+            rOStream << (i_size > 0 ? "," : "") << "\n        {\"num_nodes\": " << model_part.NumberOfNodes() << ", \"num_elements\": " << model_part.NumberOfElements() << ", \"num_repetitions\": " << NUM_MESH_REPETITIONS << ", ";
+            WriteStatistics(rOStream, times);
+            rOStream << "}";
+        } else {
+            for (int i=0; i<NUM_MESH_REPETITIONS; ++i) {
+                model_part.Clear();
+                CoSimIO::ImportMesh(info_mesh, model_part);
+                CoSimIO::ExportInfo(info_ack);
+            }
+        }
+    }
+
+    if (IsMeasuring) {
+        rOStream << "]";
+    }
+}
+
+// executed in each of the two launched processes
+int RunBenchmarkProcess(
+    const std::string& rSide,
+    const std::string& rCommunicationFormat,
+    const std::size_t MaxDataSize,
+    const std::string& rResultFileName)
+{
+    const bool is_measuring = rSide == "a";
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", is_measuring ? "benchmark_a" : "benchmark_b");
+    settings.Set("connect_to", is_measuring ? "benchmark_b" : "benchmark_a");
+    settings.Set("communication_format", rCommunicationFormat);
+    settings.Set("echo_level", 0);
+
+    CoSimIO::Info connect_info;
+#ifdef CO_SIM_IO_USING_MPI
+    if (rCommunicationFormat == "mpi_inter") {
+        MPI_Init(nullptr, nullptr);
+        connect_info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    } else {
+        connect_info = CoSimIO::Connect(settings);
+    }
+#else
+    connect_info = CoSimIO::Connect(settings);
+#endif
+    const std::string connection_name = connect_info.Get<std::string>("connection_name");
+
+    std::stringstream results;
+    results << std::setprecision(9);
+
+    RunLatency(connection_name, is_measuring, results);
+    results << ",\n    ";
+    RunBandwidth(connection_name, is_measuring, MaxDataSize, results);
+    results << ",\n    ";
+    RunMesh(connection_name, is_measuring, results);
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    CoSimIO::Disconnect(disconnect_settings);
+
+#ifdef CO_SIM_IO_USING_MPI
+    if (rCommunicationFormat == "mpi_inter") {
+        MPI_Finalize();
+    }
+#endif
+
+    if (is_measuring) {
+        std::ofstream result_file(rResultFileName);
+        result_file << results.str();
+    }
+
+    return 0;
+}
+
+std::string Quote(const std::string& rString)
+{
+    return "\"" + rString + "\"";
+}
+
+// launches the two processes for one format and returns the JSON members with the results
+std::string LaunchBenchmark(
+    const std::string& rExecutable,
+    const std::string& rCommunicationFormat,
+    const std::size_t MaxDataSize)
+{
+    const std::string result_file_name = "co_sim_io_benchmark_" + rCommunicationFormat + ".json.tmp";
+
+    std::string launcher;
+#ifdef CO_SIM_IO_USING_MPI
+    if (rCommunicationFormat == "mpi_inter") {
+        launcher = Quote(CO_SIM_IO_MPIEXEC) + " -np 1 ";
+    }
+#endif
+
+    int exit_codes[2];
+    std::vector<std::thread> threads;
+    for (int i=0; i<2; ++i) {
+        const std::string side = (i==0) ? "a" : "b";
+        const std::string command = launcher + Quote(rExecutable) + " --run " + side + " " + rCommunicationFormat + " " + std::to_string(MaxDataSize) + " " + Quote(result_file_name);
+        threads.emplace_back([command, &exit_codes, i](){
+            exit_codes[i] = std::system(command.c_str());
+        });
+    }
+
+    for (auto& r_thread : threads) {
+        r_thread.join();
+    }
+
+    if (exit_codes[0] != 0 || exit_codes[1] != 0) {
+        return "\"error\": \"the benchmark processes failed with exit codes " + std::to_string(exit_codes[0]) + " and " + std::to_string(exit_codes[1]) + "\"";
+    }
+
+    std::ifstream result_file(result_file_name);
+    std::stringstream results;
+    results << result_file.rdbuf();
+    result_file.close();
+    std::remove(result_file_name.c_str());
+
+    return results.str();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--run") {
+        CO_SIM_IO_ERROR_IF(argc != 6) << "Wrong number of arguments for running a benchmark process!" << std::endl;
+        return RunBenchmarkProcess(argv[2], argv[3], std::strtoul(argv[4], nullptr, 10), argv[5]);
+    }
+
+    // the executable is launched again for each process, hence it should be called with its full path
+    const std::string executable = argv[0];
+    const std::string output_file_name = (argc > 1) ? argv[1] : "";
+    const std::size_t max_data_size = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1073741824;
+
+    std::vector<std::string> formats;
+    for (int i=3; i<argc; ++i) {
+        formats.push_back(argv[i]);
+    }
+    if (formats.empty()) {
+        formats = GetAvailableCommunicationFormats();
+    }
+
+    std::stringstream results;
+    results << "{\n";
+    results << "\"co_sim_io_version\": \"" << CoSimIO::GetMajorVersion() << "." << CoSimIO::GetMinorVersion() << "." << CoSimIO::GetPatchVersion() << "\",\n";
+    results << "\"max_data_size\": " << max_data_size << ",\n";
+    results << "\"results\": [";
+
+    for (std::size_t i=0; i<formats.size(); ++i) {
+        std::cerr << "Running benchmark for \"" << formats[i] << "\" ..." << std::endl;
+        results << (i > 0 ? "," : "") << "\n    {\"communication_format\": \"" << formats[i] << "\",\n    ";
+        results << LaunchBenchmark(executable, formats[i], max_data_size) << "}";
+    }
+
+    results << "\n]\n}\n";
+
+    if (output_file_name.empty()) {
+        std::cout << results.str();
+    } else {
+        std::ofstream output_file(output_file_name);
+        output_file << results.str();
+        std::cerr << "The results were written to \"" << output_file_name << "\"" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,400 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Microbenchmarks of the hot paths that don't involve communication:
+// - Serializer: save/load of Info, DataContainer and ModelPart with every TraceType
+// - ModelPart: CreateNewNodes / CreateNewElements from 1e3 up to the maximum number of entities
+// - VtkUtilities: WriteVtk / ReadVtk
+// The results are written in JSON format (one case per line). If a baseline (a previous result file)
+// is given, then the minimum times are compared and the exit code is 1 if a case is slower than the tolerance allows
+// Usage: co_sim_io_micro_benchmark [--output file] [--baseline file] [--tolerance factor] [--max-entities number] [--filter substring]
+
+// System includes
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+
+// Project includes
+#include "includes/define.hpp"
+#include "includes/utilities.hpp"
+#include "includes/info.hpp"
+#include "includes/data_container.hpp"
+#include "includes/model_part.hpp"
+#include "includes/stream_serializer.hpp"
+#include "includes/vtk_utilities.hpp"
+
+namespace {
+
+using CoSimIO::Internals::Serializer;
+using CoSimIO::Internals::StreamSerializer;
+
+// each case is repeated until this time is reached (but at least MIN_REPETITIONS times)
+constexpr double TIME_PER_CASE = 0.5;
+constexpr int MIN_REPETITIONS = 5;
+constexpr int MAX_REPETITIONS = 1000;
+
+struct BenchmarkCase
+{
+    std::string Name;
+    // executes the case once and returns the time [s] of the measured part
+    std::function<double()> Run;
+};
+
+struct BenchmarkResult
+{
+    std::string Name;
+    int NumRepetitions;
+    double MinTime;
+    double MedianTime;
+};
+
+BenchmarkResult RunCase(const BenchmarkCase& rCase)
+{
+    std::vector<double> times;
+    double total_time = 0.0;
+    while (static_cast<int>(times.size()) < MAX_REPETITIONS && (static_cast<int>(times.size()) < MIN_REPETITIONS || total_time < TIME_PER_CASE)) {
+        times.push_back(rCase.Run());
+        total_time += times.back();
+    }
+
+    std::sort(times.begin(), times.end());
+    return {rCase.Name, static_cast<int>(times.size()), times.front(), times[times.size()/2]};
+}
+
+// the output of SERIALIZER_TRACE_ALL is discarded, such that only the overhead of creating it is measured
+class DiscardOutput
+{
+public:
+    DiscardOutput() : mpOriginalBuffer(std::cout.rdbuf(&mNullBuffer)) {}
+    ~DiscardOutput() {std::cout.rdbuf(mpOriginalBuffer);}
+
+private:
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int_type overflow(int_type Char) override {return traits_type::not_eof(Char);}
+    };
+
+    NullBuffer mNullBuffer;
+    std::streambuf* mpOriginalBuffer;
+};
+
+template<class TFunctionType>
+double MeasureTime(TFunctionType&& rFunction)
+{
+    const auto start_time(std::chrono::steady_clock::now());
+    rFunction();
+    return CoSimIO::Utilities::ElapsedSeconds(start_time);
+}
+
+std::vector<std::pair<std::string, Serializer::TraceType>> GetTraceTypes()
+{
+    return {
+        {"binary",      Serializer::SERIALIZER_NO_TRACE},
+        {"trace_error", Serializer::SERIALIZER_TRACE_ERROR},
+        {"trace_all",   Serializer::SERIALIZER_TRACE_ALL},
+        {"ascii",       Serializer::SERIALIZER_ASCII}
+    };
+}
+
+CoSimIO::Info CreateInfo()
+{
+    CoSimIO::Info sub_info;
+    sub_info.Set<std::string>("identifier", "sub_info");
+    sub_info.Set<bool>("is_converged", true);
+
+    CoSimIO::Info info;
+    for (int i=0; i<100; ++i) {
+        info.Set<int>("int_"+std::to_string(i), i);
+        info.Set<double>("double_"+std::to_string(i), 1.5*i);
+        info.Set<std::string>("string_"+std::to_string(i), "value_"+std::to_string(i));
+        info.Set<CoSimIO::Info>("info_"+std::to_string(i), sub_info);
+    }
+    return info;
+}
+
+// the container shares the ownership of the vector with its values
+std::shared_ptr<CoSimIO::Internals::DataContainer<double>> CreateDataContainer(const std::size_t Size)
+{
+    struct VectorAndContainer
+    {
+        std::vector<double> Values;
+        CoSimIO::Internals::DataContainerStdVector<double> Container;
+        explicit VectorAndContainer(const std::size_t Size) : Values(Size, 1.2345678), Container(Values) {}
+    };
+
+    auto p_vector_and_container = std::make_shared<VectorAndContainer>(Size);
+    return std::shared_ptr<CoSimIO::Internals::DataContainer<double>>(p_vector_and_container, &p_vector_and_container->Container);
+}
+
+void CreateStructuredMesh(CoSimIO::ModelPart& rModelPart, const std::size_t NumElementsPerDirection)
+{
+    const std::size_t num_nodes_per_direction = NumElementsPerDirection+1;
+
+    for (std::size_t i=0; i<num_nodes_per_direction; ++i) {
+        for (std::size_t j=0; j<num_nodes_per_direction; ++j) {
+            rModelPart.CreateNewNode(i*num_nodes_per_direction+j+1, static_cast<double>(i), static_cast<double>(j), 0.0);
+        }
+    }
+
+    for (std::size_t i=0; i<NumElementsPerDirection; ++i) {
+        for (std::size_t j=0; j<NumElementsPerDirection; ++j) {
+            const CoSimIO::IdType id_1 = i*num_nodes_per_direction+j+1;
+            const CoSimIO::IdType id_2 = id_1+num_nodes_per_direction;
+            rModelPart.CreateNewElement(i*NumElementsPerDirection+j+1, CoSimIO::ElementType::Quadrilateral2D4, {id_1, id_2, id_2+1, id_1+1});
+        }
+    }
+}
+
+// saving and loading an object with the Serializer
+template<class TObjectType, class TCreateFunctionType>
+void AddSerializerCases(
+    std::vector<BenchmarkCase>& rCases,
+    const std::string& rName,
+    std::shared_ptr<TObjectType> pObject,
+    TCreateFunctionType&& rCreateEmpty)
+{
+    for (const auto& r_trace_type : GetTraceTypes()) {
+        const Serializer::TraceType trace_type = r_trace_type.second;
+        auto p_data = std::make_shared<std::string>();
+
+        rCases.push_back({"serializer_" + rName + "_save_" + r_trace_type.first, [pObject, p_data, trace_type](){
+            DiscardOutput discard_output;
+            StreamSerializer serializer(trace_type);
+            const double time = MeasureTime([&](){
+                serializer.save("object", *pObject);
+            });
+            *p_data = serializer.ExtractStringRepresentation();
+            return time;
+        }});
+
+        rCases.push_back({"serializer_" + rName + "_load_" + r_trace_type.first, [p_data, trace_type, rCreateEmpty](){
+            DiscardOutput discard_output;
+            auto p_object = rCreateEmpty();
+            StreamSerializer serializer(*p_data, trace_type);
+            return MeasureTime([&](){
+                serializer.load("object", *p_object);
+            });
+        }});
+    }
+}
+
+void AddModelPartCases(std::vector<BenchmarkCase>& rCases, const std::size_t MaxEntities)
+{
+    for (std::size_t num_entities=1000; num_entities<=MaxEntities; num_entities*=10) {
+        rCases.push_back({"model_part_create_nodes_" + std::to_string(num_entities), [num_entities](){
+            std::vector<CoSimIO::IdType> ids(num_entities);
+            std::vector<double> coords(num_entities);
+            for (std::size_t i=0; i<num_entities; ++i) {
+                ids[i] = static_cast<CoSimIO::IdType>(i+1);
+                coords[i] = 0.5*i;
+            }
+
+            CoSimIO::ModelPart model_part("benchmark");
+            return MeasureTime([&](){
+                model_part.CreateNewNodes(ids, coords, coords, coords);
+            });
+        }});
+
+        // chain of lines, each node is used by two elements
+        rCases.push_back({"model_part_create_elements_" + std::to_string(num_entities), [num_entities](){
+            std::vector<CoSimIO::IdType> node_ids(num_entities+1);
+            std::vector<double> coords(num_entities+1);
+            for (std::size_t i=0; i<num_entities+1; ++i) {
+                node_ids[i] = static_cast<CoSimIO::IdType>(i+1);
+                coords[i] = 0.5*i;
+            }
+
+            std::vector<CoSimIO::IdType> ids(num_entities);
+            std::vector<CoSimIO::ElementType> types(num_entities, CoSimIO::ElementType::Line2D2);
+            std::vector<CoSimIO::IdType> connectivities(2*num_entities);
+            for (std::size_t i=0; i<num_entities; ++i) {
+                ids[i] = static_cast<CoSimIO::IdType>(i+1);
+                connectivities[2*i] = static_cast<CoSimIO::IdType>(i+1);
+                connectivities[2*i+1] = static_cast<CoSimIO::IdType>(i+2);
+            }
+
+            CoSimIO::ModelPart model_part("benchmark");
+            model_part.CreateNewNodes(node_ids, coords, coords, coords);
+            return MeasureTime([&](){
+                model_part.CreateNewElements(ids, types, connectivities);
+            });
+        }});
+    }
+}
+
+void AddVtkCases(std::vector<BenchmarkCase>& rCases)
+{
+    for (const std::size_t num_elements_per_direction : {100, 300}) {
+        const std::string size = std::to_string(num_elements_per_direction*num_elements_per_direction);
+        const std::string file_name = "co_sim_io_micro_benchmark_" + size + ".vtk";
+
+        auto p_model_part = std::make_shared<CoSimIO::ModelPart>("benchmark");
+        CreateStructuredMesh(*p_model_part, num_elements_per_direction);
+
+        CoSimIO::Info settings;
+        settings.Set<std::string>("file_name", file_name);
+
+        rCases.push_back({"vtk_write_" + size, [p_model_part, settings](){
+            return MeasureTime([&](){
+                CoSimIO::VtkUtilities::WriteVtk(settings, *p_model_part);
+            });
+        }});
+
+        rCases.push_back({"vtk_read_" + size, [settings](){
+            CoSimIO::ModelPart model_part("benchmark");
+            return MeasureTime([&](){
+                CoSimIO::VtkUtilities::ReadVtk(settings, model_part);
+            });
+        }});
+    }
+}
+
+std::vector<BenchmarkCase> CreateCases(const std::size_t MaxEntities)
+{
+    std::vector<BenchmarkCase> cases;
+
+    AddSerializerCases(cases, "info",
+        std::make_shared<CoSimIO::Info>(CreateInfo()),
+        [](){return std::make_shared<CoSimIO::Info>();});
+
+    AddSerializerCases(cases, "data_container",
+        CreateDataContainer(1000000),
+        [](){return CreateDataContainer(0);});
+
+    auto p_model_part = std::make_shared<CoSimIO::ModelPart>("benchmark");
+    CreateStructuredMesh(*p_model_part, 200);
+    AddSerializerCases(cases, "model_part", p_model_part,
+        [](){return std::make_shared<CoSimIO::ModelPart>("benchmark");});
+
+    AddModelPartCases(cases, MaxEntities);
+
+    AddVtkCases(cases);
+
+    return cases;
+}
+
+// reads the minimum times of a result file written by this benchmark (one case per line)
+std::map<std::string, double> ReadBaseline(const std::string& rFileName)
+{
+    std::ifstream baseline_file(rFileName);
+    CO_SIM_IO_ERROR_IF_NOT(baseline_file.is_open()) << "The baseline \"" << rFileName << "\" could not be opened!" << std::endl;
+
+    const std::string name_key = "\"name\": \"";
+    const std::string time_key = "\"min_time\": ";
+
+    std::map<std::string, double> min_times;
+    std::string line;
+    while (std::getline(baseline_file, line)) {
+        const std::size_t pos_name = line.find(name_key);
+        const std::size_t pos_time = line.find(time_key);
+        if (pos_name != std::string::npos && pos_time != std::string::npos) {
+            const std::size_t begin_name = pos_name+name_key.size();
+            const std::string name = line.substr(begin_name, line.find('"', begin_name)-begin_name);
+            min_times[name] = std::strtod(line.c_str()+pos_time+time_key.size(), nullptr);
+        }
+    }
+
+    return min_times;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::string output_file_name;
+    std::string baseline_file_name;
+    double tolerance = 2.0;
+    std::size_t max_entities = 10000000;
+    std::string filter;
+
+    for (int i=1; i<argc; ++i) {
+        const std::string arg = argv[i];
+        CO_SIM_IO_ERROR_IF(i+1 >= argc) << "Missing value for argument \"" << arg << "\"!" << std::endl;
+        const std::string value = argv[++i];
+        if (arg == "--output") {
+            output_file_name = value;
+        } else if (arg == "--baseline") {
+            baseline_file_name = value;
+        } else if (arg == "--tolerance") {
+            tolerance = std::strtod(value.c_str(), nullptr);
+        } else if (arg == "--max-entities") {
+            max_entities = std::strtoul(value.c_str(), nullptr, 10);
+        } else if (arg == "--filter") {
+            filter = value;
+        } else {
+            CO_SIM_IO_ERROR << "Unknown argument \"" << arg << "\"!" << std::endl;
+        }
+    }
+
+    std::map<std::string, double> baseline;
+    if (!baseline_file_name.empty()) {
+        baseline = ReadBaseline(baseline_file_name);
+    }
+
+    std::stringstream results;
+    results << std::setprecision(6);
+    results << "{\n\"results\": [";
+
+    std::cout << std::left << std::setw(44) << "case" << std::right << std::setw(8) << "reps" << std::setw(14) << "min [s]" << std::setw(14) << "median [s]" << std::setw(12) << "baseline" << std::endl;
+    std::cout << std::setprecision(4);
+
+    std::vector<std::string> regressions;
+    bool is_first = true;
+    for (const auto& r_case : CreateCases(max_entities)) {
+        if (r_case.Name.find(filter) == std::string::npos) continue;
+
+        const BenchmarkResult result = RunCase(r_case);
+
+        results << (is_first ? "" : ",") << "\n    {\"name\": \"" << result.Name << "\", \"num_repetitions\": " << result.NumRepetitions
+                << ", \"min_time\": " << result.MinTime << ", \"median_time\": " << result.MedianTime << "}";
+        is_first = false;
+
+        std::cout << std::left << std::setw(44) << result.Name << std::right << std::setw(8) << result.NumRepetitions << std::setw(14) << result.MinTime << std::setw(14) << result.MedianTime;
+
+        const auto it_baseline = baseline.find(result.Name);
+        if (it_baseline != baseline.end()) {
+            // relative to the baseline, larger than one means slower
+            const double ratio = result.MinTime / it_baseline->second;
+            std::cout << std::setw(11) << ratio << "x";
+            if (ratio > tolerance) {
+                std::cout << " REGRESSION";
+                regressions.push_back(result.Name);
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    results << "\n]\n}\n";
+
+    if (!output_file_name.empty()) {
+        std::ofstream output_file(output_file_name);
+        output_file << results.str();
+        std::cout << "\nThe results were written to \"" << output_file_name << "\"" << std::endl;
+    }
+
+    if (!regressions.empty()) {
+        std::cout << "\n" << regressions.size() << " case(s) are more than " << tolerance << " times slower than the baseline!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
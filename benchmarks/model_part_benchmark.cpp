@@ -0,0 +1,179 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Microbenchmark of the serialization of a ModelPart
+// Round-trips a structured quadrilateral mesh through the Serializer, which tracks
+// the pointers to every node and element. Additionally the pointer tracking is
+// compared between std::set/std::map (as it was done before) and the PointerHashMap
+// Usage: co_sim_io_model_part_benchmark [number_of_elements_per_direction] [number_of_repetitions]
+
+// System includes
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <chrono>
+#include <cstdlib>
+
+// Project includes
+#include "includes/define.hpp"
+#include "includes/utilities.hpp"
+#include "includes/model_part.hpp"
+#include "includes/stream_serializer.hpp"
+#include "includes/pointer_hash_map.hpp"
+
+namespace {
+
+using CoSimIO::Internals::StreamSerializer;
+
+template<class TFunctionType>
+double MinimumTime(const int NumRepetitions, TFunctionType&& rFunction)
+{
+    double min_time = 1e100;
+    for (int i=0; i<NumRepetitions; ++i) {
+        const auto start_time(std::chrono::steady_clock::now());
+        rFunction();
+        min_time = std::min(min_time, CoSimIO::Utilities::ElapsedSeconds(start_time));
+    }
+    return min_time;
+}
+
+void CreateStructuredMesh(CoSimIO::ModelPart& rModelPart, const std::size_t NumElementsPerDirection)
+{
+    const std::size_t num_nodes_per_direction = NumElementsPerDirection+1;
+
+    for (std::size_t i=0; i<num_nodes_per_direction; ++i) {
+        for (std::size_t j=0; j<num_nodes_per_direction; ++j) {
+            rModelPart.CreateNewNode(i*num_nodes_per_direction+j+1, static_cast<double>(i), static_cast<double>(j), 0.0);
+        }
+    }
+
+    for (std::size_t i=0; i<NumElementsPerDirection; ++i) {
+        for (std::size_t j=0; j<NumElementsPerDirection; ++j) {
+            const CoSimIO::IdType id_1 = i*num_nodes_per_direction+j+1;
+            const CoSimIO::IdType id_2 = id_1+num_nodes_per_direction;
+            rModelPart.CreateNewElement(i*NumElementsPerDirection+j+1, CoSimIO::ElementType::Quadrilateral2D4, {id_1, id_2, id_2+1, id_1+1});
+        }
+    }
+}
+
+void RunModelPartBenchmark(const CoSimIO::ModelPart& rModelPart, const int NumRepetitions)
+{
+    std::string data;
+
+    const double time_save = MinimumTime(NumRepetitions, [&](){
+        StreamSerializer serializer;
+        serializer.save("model_part", rModelPart);
+        data = serializer.GetStringRepresentation();
+    });
+
+    CoSimIO::ModelPart model_part_load(rModelPart.Name());
+    const double time_load = MinimumTime(NumRepetitions, [&](){
+        model_part_load.Clear();
+        StreamSerializer serializer(data);
+        serializer.load("model_part", model_part_load);
+    });
+
+    CO_SIM_IO_ERROR_IF(model_part_load.NumberOfNodes() != rModelPart.NumberOfNodes()) << "Wrong number of nodes loaded!" << std::endl;
+    CO_SIM_IO_ERROR_IF(model_part_load.NumberOfElements() != rModelPart.NumberOfElements()) << "Wrong number of elements loaded!" << std::endl;
+
+    std::cout << "ModelPart round-trip, minimum time [s] of " << NumRepetitions << " repetitions" << std::endl;
+    std::cout << std::setw(14) << "save" << std::setw(14) << "load" << std::setw(14) << "size [MB]" << std::endl;
+    std::cout << std::setw(14) << time_save << std::setw(14) << time_load << std::setw(14) << data.size()/1.0e6 << "\n" << std::endl;
+}
+
+// the access pattern of the Serializer: every pointer is looked up and inserted,
+// and each node is referenced again by the elements
+void RunPointerTrackingBenchmark(const CoSimIO::ModelPart& rModelPart, const int NumRepetitions)
+{
+    std::vector<const void*> pointers;
+    pointers.reserve(rModelPart.NumberOfNodes() + 5*rModelPart.NumberOfElements());
+    for (auto it_node = rModelPart.NodesBegin(); it_node != rModelPart.NodesEnd(); ++it_node) {
+        pointers.push_back(&**it_node);
+    }
+    for (auto it_elem = rModelPart.ElementsBegin(); it_elem != rModelPart.ElementsEnd(); ++it_elem) {
+        pointers.push_back(&**it_elem);
+        for (auto it_node = (*it_elem)->NodesBegin(); it_node != (*it_elem)->NodesEnd(); ++it_node) {
+            pointers.push_back(&**it_node);
+        }
+    }
+
+    std::size_t num_unique_set = 0, num_unique_map = 0, num_unique_hash_set = 0, num_unique_hash_map = 0;
+
+    const double time_set = MinimumTime(NumRepetitions, [&](){
+        std::set<const void*> saved_pointers;
+        for (const void* p : pointers) {
+            if (saved_pointers.find(p) == saved_pointers.end()) {
+                saved_pointers.insert(p);
+            }
+        }
+        num_unique_set = saved_pointers.size();
+    });
+
+    const double time_hash_set = MinimumTime(NumRepetitions, [&](){
+        CoSimIO::Internals::PointerHashMap<bool> saved_pointers;
+        for (const void* p : pointers) {
+            saved_pointers.insert(p, true);
+        }
+        num_unique_hash_set = saved_pointers.size();
+    });
+
+    const double time_map = MinimumTime(NumRepetitions, [&](){
+        std::map<const void*, void*> loaded_pointers;
+        for (const void* p : pointers) {
+            auto it = loaded_pointers.find(p);
+            if (it == loaded_pointers.end()) {
+                loaded_pointers[p] = const_cast<void*>(p);
+            }
+        }
+        num_unique_map = loaded_pointers.size();
+    });
+
+    const double time_hash_map = MinimumTime(NumRepetitions, [&](){
+        CoSimIO::Internals::PointerHashMap<void*> loaded_pointers;
+        for (const void* p : pointers) {
+            if (loaded_pointers.find(p) == nullptr) {
+                loaded_pointers.insert(p, const_cast<void*>(p));
+            }
+        }
+        num_unique_hash_map = loaded_pointers.size();
+    });
+
+    CO_SIM_IO_ERROR_IF(num_unique_set != num_unique_hash_set || num_unique_map != num_unique_hash_map) << "Number of tracked pointers differs!" << std::endl;
+
+    std::cout << "Pointer tracking of " << pointers.size() << " accesses (" << num_unique_set << " unique pointers), minimum time [s] of " << NumRepetitions << " repetitions" << std::endl;
+    std::cout << std::left << std::setw(14) << "container" << std::right << std::setw(14) << "std" << std::setw(14) << "hash" << std::setw(10) << "speedup" << std::endl;
+    std::cout << std::left << std::setw(14) << "saved" << std::right << std::setw(14) << time_set << std::setw(14) << time_hash_set << std::setw(10) << time_set/time_hash_set << std::endl;
+    std::cout << std::left << std::setw(14) << "loaded" << std::right << std::setw(14) << time_map << std::setw(14) << time_hash_map << std::setw(10) << time_map/time_hash_map << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t num_elements_per_direction = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 500;
+    const int num_repetitions = (argc > 2) ? std::atoi(argv[2]) : 5;
+
+    CoSimIO::ModelPart model_part("benchmark");
+    CreateStructuredMesh(model_part, num_elements_per_direction);
+
+    std::cout << "ModelPart with " << model_part.NumberOfNodes() << " nodes and " << model_part.NumberOfElements() << " elements\n" << std::endl;
+
+    std::cout << std::setprecision(4);
+
+    RunModelPartBenchmark(model_part, num_repetitions);
+    RunPointerTrackingBenchmark(model_part, num_repetitions);
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Throughput benchmark of the pipe communication
+// Exchanges data between two threads for different buffer sizes of the pipes (with and without vmsplice)
+// Usage: co_sim_io_pipe_benchmark [number_of_values] [number_of_repetitions]
+
+// System includes
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <chrono>
+#include <cstdlib>
+
+// Project includes
+#include "includes/define.hpp"
+#include "includes/utilities.hpp"
+#include "includes/communication/communication.hpp"
+#include "includes/communication/factory.hpp"
+
+namespace {
+
+using CoSimIO::Internals::Communication;
+
+std::unique_ptr<Communication> CreateCommunication(
+    CoSimIO::Info Settings,
+    const bool IsPrimary)
+{
+    Settings.Set<std::string>("communication_format", "pipe");
+    Settings.Set<std::string>("my_name", IsPrimary ? "importer" : "exporter");
+    Settings.Set<std::string>("connect_to", IsPrimary ? "exporter" : "importer");
+    Settings.Set<bool>("is_primary_connection", IsPrimary);
+    Settings.Set<int>("echo_level", 0);
+
+    return CoSimIO::Internals::CommunicationFactory().Create(Settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+}
+
+void ExportData(
+    const CoSimIO::Info& rSettings,
+    const std::vector<double>& rData,
+    const int NumRepetitions)
+{
+    std::unique_ptr<Communication> p_comm = CreateCommunication(rSettings, false);
+
+    // the secondary should wait a bit until the primary has created the folder
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", "benchmark");
+    const CoSimIO::Internals::DataContainerStdVectorReadOnly<double> data_container(rData);
+    for (int i=0; i<NumRepetitions; ++i) {
+        p_comm->ExportData(export_info, data_container);
+    }
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+}
+
+void RunBenchmark(
+    const int BufferSize,
+    const bool UseVmsplice,
+    const std::size_t NumValues,
+    const int NumRepetitions)
+{
+    CoSimIO::Info settings;
+    settings.Set<int>("buffer_size", BufferSize);
+    settings.Set<bool>("use_vmsplice", UseVmsplice);
+
+    const std::vector<double> data_to_export(NumValues, 1.5);
+    std::thread export_thread(ExportData, settings, std::cref(data_to_export), NumRepetitions);
+
+    std::unique_ptr<Communication> p_comm = CreateCommunication(settings, true);
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "benchmark");
+    std::vector<double> data;
+    CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+
+    double min_time = 1e100;
+    for (int i=0; i<NumRepetitions; ++i) {
+        const auto start_time(std::chrono::steady_clock::now());
+        p_comm->ImportData(import_info, data_container);
+        min_time = std::min(min_time, CoSimIO::Utilities::ElapsedSeconds(start_time));
+    }
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    export_thread.join();
+
+    CO_SIM_IO_ERROR_IF(data != data_to_export) << "Imported data is wrong!" << std::endl;
+
+    const double size_GB = NumValues*sizeof(double) / 1e9;
+
+    std::cout << std::setw(14) << BufferSize << std::setw(10) << (UseVmsplice ? "yes" : "no")
+              << std::setw(14) << min_time << std::setw(14) << size_GB/min_time
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+#ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    std::cout << "The pipe communication is not available in Windows" << std::endl;
+#else
+    const std::size_t num_values = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 8000000;
+    const int num_repetitions = (argc > 2) ? std::atoi(argv[2]) : 5;
+
+    std::cout << "Exchanging " << num_values << " values, minimum time [s] of " << num_repetitions << " repetitions\n" << std::endl;
+
+    std::cout << std::setw(14) << "buffer size" << std::setw(10) << "vmsplice"
+              << std::setw(14) << "time" << std::setw(14) << "GB/s"
+              << std::endl;
+
+    std::cout << std::setprecision(4);
+
+    for (const int buffer_size : {8192, 65536, 262144, 1048576, 4194304}) {
+        RunBenchmark(buffer_size, false, num_values, num_repetitions);
+    }
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    for (const int buffer_size : {65536, 1048576}) {
+        RunBenchmark(buffer_size, true, num_values, num_repetitions);
+    }
+#endif
+#endif
+
+    return 0;
+}
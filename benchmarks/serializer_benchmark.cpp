@@ -0,0 +1,132 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// Microbenchmark of the serialization of vectors
+// Compares saving/loading the values one by one (as it was done before)
+// with saving/loading them as one contiguous block
+// Usage: co_sim_io_serializer_benchmark [number_of_values] [number_of_repetitions]
+
+// System includes
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+// Project includes
+#include "includes/define.hpp"
+#include "includes/utilities.hpp"
+#include "includes/stream_serializer.hpp"
+
+namespace {
+
+using CoSimIO::Internals::StreamSerializer;
+
+template<class TDataType>
+void SaveOneByOne(StreamSerializer& rSerializer, const std::vector<TDataType>& rValues)
+{
+    rSerializer.save("size", rValues.size());
+    for (const auto& r_value : rValues) {
+        rSerializer.save("E", r_value);
+    }
+}
+
+template<class TDataType>
+void LoadOneByOne(StreamSerializer& rSerializer, std::vector<TDataType>& rValues)
+{
+    std::size_t size;
+    rSerializer.load("size", size);
+    rValues.resize(size);
+    for (auto& r_value : rValues) {
+        rSerializer.load("E", r_value);
+    }
+}
+
+template<class TFunctionType>
+double MinimumTime(const int NumRepetitions, TFunctionType&& rFunction)
+{
+    double min_time = 1e100;
+    for (int i=0; i<NumRepetitions; ++i) {
+        const auto start_time(std::chrono::steady_clock::now());
+        rFunction();
+        min_time = std::min(min_time, CoSimIO::Utilities::ElapsedSeconds(start_time));
+    }
+    return min_time;
+}
+
+template<class TDataType>
+void RunBenchmark(
+    const std::string& rName,
+    const std::size_t NumValues,
+    const int NumRepetitions)
+{
+    std::vector<TDataType> values(NumValues);
+    for (std::size_t i=0; i<NumValues; ++i) {
+        values[i] = static_cast<TDataType>(i%1000 * 1.5);
+    }
+    std::vector<TDataType> loaded_values;
+
+    std::string one_by_one_data, contiguous_data;
+
+    const double time_save_one_by_one = MinimumTime(NumRepetitions, [&](){
+        StreamSerializer serializer;
+        SaveOneByOne(serializer, values);
+        one_by_one_data = serializer.GetStringRepresentation();
+    });
+
+    const double time_save_contiguous = MinimumTime(NumRepetitions, [&](){
+        StreamSerializer serializer;
+        serializer.save("values", values);
+        contiguous_data = serializer.GetStringRepresentation();
+    });
+
+    const double time_load_one_by_one = MinimumTime(NumRepetitions, [&](){
+        StreamSerializer serializer(one_by_one_data);
+        LoadOneByOne(serializer, loaded_values);
+    });
+
+    const double time_load_contiguous = MinimumTime(NumRepetitions, [&](){
+        StreamSerializer serializer(contiguous_data);
+        serializer.load("values", loaded_values);
+    });
+
+    CO_SIM_IO_ERROR_IF(loaded_values != values) << "Loaded values of " << rName << " are wrong!" << std::endl;
+
+    std::cout << std::left << std::setw(22) << rName << std::right
+              << std::setw(14) << time_save_one_by_one << std::setw(14) << time_save_contiguous << std::setw(10) << time_save_one_by_one/time_save_contiguous
+              << std::setw(14) << time_load_one_by_one << std::setw(14) << time_load_contiguous << std::setw(10) << time_load_one_by_one/time_load_contiguous
+              << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t num_values = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 5000000;
+    const int num_repetitions = (argc > 2) ? std::atoi(argv[2]) : 5;
+
+    std::cout << "Serializing " << num_values << " values, minimum time [s] of " << num_repetitions << " repetitions\n" << std::endl;
+
+    std::cout << std::left << std::setw(22) << "type" << std::right
+              << std::setw(14) << "save 1-by-1" << std::setw(14) << "save block" << std::setw(10) << "speedup"
+              << std::setw(14) << "load 1-by-1" << std::setw(14) << "load block" << std::setw(10) << "speedup"
+              << std::endl;
+
+    std::cout << std::setprecision(4);
+
+    RunBenchmark<double>("std::vector<double>", num_values, num_repetitions);
+    RunBenchmark<int>("std::vector<int>", num_values, num_repetitions);
+    RunBenchmark<CoSimIO::IdType>("ConnectivitiesType", num_values, num_repetitions);
+
+    return 0;
+}
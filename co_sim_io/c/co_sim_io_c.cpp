@@ -10,6 +10,11 @@
 //  Main authors:    Philipp Bucher (https://github.com/philbucher)
 //
 
+// System includes
+#include <map>
+#include <mutex>
+#include <utility>
+
 // Project includes
 extern "C" {
 #include "co_sim_io_c.h"
@@ -31,6 +36,31 @@ namespace {
     CoSimIO::Info ConvertInfo(CoSimIO_Info I_Info) {
         return CoSimIO::Info(*(static_cast<CoSimIO::Info*>(I_Info.PtrCppInfo)));
     }
+
+    // the containers of the asynchronous requests have to stay alive until the requests are completed
+    struct AsyncRequestData
+    {
+        std::unique_ptr<CoSimIO::Internals::DataContainer<double>> pContainer;
+        int* pSize; // nullptr for exports
+    };
+
+    using AsyncRequestKeyType = std::pair<std::string, int>; // connection name and request id
+
+    AsyncRequestKeyType GetAsyncRequestKey(const CoSimIO::Info& I_Info) {
+        return std::make_pair(I_Info.Get<std::string>("connection_name"), I_Info.Get<int>("request_id"));
+    }
+
+    // the requests can be completed from different threads than they were started in
+    std::map<AsyncRequestKeyType, AsyncRequestData> s_async_requests;
+    std::mutex s_async_requests_mutex;
+
+    void AddAsyncRequest(
+        const CoSimIO::Info& I_Info,
+        AsyncRequestData&& rRequestData)
+    {
+        std::lock_guard<std::mutex> lock(s_async_requests_mutex);
+        s_async_requests[GetAsyncRequestKey(I_Info)] = std::move(rRequestData);
+    }
 }
 
 
@@ -71,6 +101,88 @@ CoSimIO_Info CoSimIO_ExportData(
     return ConvertInfo(CoSimIO::ExportData(ConvertInfo(I_Info), *p_container));
 }
 
+CoSimIO_Info CoSimIO_BorrowData(
+    const CoSimIO_Info I_Info,
+    int* O_Size,
+    const double** O_Data)
+{
+    std::size_t size;
+    auto info = ConvertInfo(CoSimIO::BorrowData(ConvertInfo(I_Info), *O_Data, size));
+    *O_Size = static_cast<int>(size);
+    return info;
+}
+
+CoSimIO_Info CoSimIO_ReleaseData(
+    const CoSimIO_Info I_Info)
+{
+    return ConvertInfo(CoSimIO::ReleaseData(ConvertInfo(I_Info)));
+}
+
+CoSimIO_Info CoSimIO_ImportDataAsync(
+    const CoSimIO_Info I_Info,
+    int* O_Size,
+    double** O_Data)
+{
+    using namespace CoSimIO::Internals;
+    std::unique_ptr<DataContainer<double>> p_container(new DataContainerRawMemory<double>(O_Data, *O_Size));
+    const CoSimIO::Info info = CoSimIO::ImportDataAsync(ConvertInfo(I_Info), *p_container);
+    AddAsyncRequest(info, AsyncRequestData{std::move(p_container), O_Size});
+    return ConvertInfo(info);
+}
+
+CoSimIO_Info CoSimIO_ExportDataAsync(
+    const CoSimIO_Info I_Info,
+    const int I_Size,
+    const double* I_Data)
+{
+    using namespace CoSimIO::Internals;
+    std::unique_ptr<DataContainer<double>> p_container(new DataContainerRawMemoryReadOnly<double>(I_Data, I_Size));
+    const CoSimIO::Info info = CoSimIO::ExportDataAsync(ConvertInfo(I_Info), *p_container);
+    AddAsyncRequest(info, AsyncRequestData{std::move(p_container), nullptr});
+    return ConvertInfo(info);
+}
+
+CoSimIO_Info CoSimIO_Wait(
+    const CoSimIO_Info I_Info)
+{
+    const CoSimIO::Info i_info = ConvertInfo(I_Info);
+
+    // the data is removed also if the request fails
+    AsyncRequestData request_data{nullptr, nullptr};
+    {
+        std::lock_guard<std::mutex> lock(s_async_requests_mutex);
+        const auto it_request = s_async_requests.find(GetAsyncRequestKey(i_info));
+        if (it_request != s_async_requests.end()) {
+            request_data = std::move(it_request->second);
+            s_async_requests.erase(it_request);
+        }
+    }
+
+    auto info = ConvertInfo(CoSimIO::Wait(i_info));
+    if (request_data.pSize) {
+        *request_data.pSize = static_cast<int>(request_data.pContainer->size());
+    }
+    return info;
+}
+
+CoSimIO_Info CoSimIO_Test(
+    const CoSimIO_Info I_Info)
+{
+    return ConvertInfo(CoSimIO::Test(ConvertInfo(I_Info)));
+}
+
+CoSimIO_Info CoSimIO_GetPerformanceStatistics(
+    const CoSimIO_Info I_Info)
+{
+    return ConvertInfo(CoSimIO::GetPerformanceStatistics(ConvertInfo(I_Info)));
+}
+
+CoSimIO_Info CoSimIO_ResetPerformanceStatistics(
+    const CoSimIO_Info I_Info)
+{
+    return ConvertInfo(CoSimIO::ResetPerformanceStatistics(ConvertInfo(I_Info)));
+}
+
 CoSimIO_Info CoSimIO_ImportMesh(
     const CoSimIO_Info I_Info,
     CoSimIO_ModelPart O_ModelPart)
@@ -53,6 +53,42 @@ CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ExportData(
     const int I_Size,
     const double* I_Data);
 
+/* "O_Data" points to memory owned by the CoSimIO, it is valid until "CoSimIO_ReleaseData" is called */
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_BorrowData(
+    const CoSimIO_Info I_Info,
+    int* O_Size,
+    const double** O_Data);
+
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ReleaseData(
+    const CoSimIO_Info I_Info);
+
+/* non-blocking versions of CoSimIO_ImportData and CoSimIO_ExportData, the returned Info contains the "request_id"
+   the arguments (including "O_Size" and "O_Data") must stay valid until the request is completed with "CoSimIO_Wait" */
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ImportDataAsync(
+    const CoSimIO_Info I_Info,
+    int* O_Size,
+    double** O_Data);
+
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ExportDataAsync(
+    const CoSimIO_Info I_Info,
+    const int I_Size,
+    const double* I_Data);
+
+/* blocks until the request is completed, "O_Size" of an import is updated here */
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_Wait(
+    const CoSimIO_Info I_Info);
+
+/* checks without blocking whether the request is completed ("is_completed") */
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_Test(
+    const CoSimIO_Info I_Info);
+
+/* accumulated counters and timings of the operations of this rank, per identifier and operation */
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_GetPerformanceStatistics(
+    const CoSimIO_Info I_Info);
+
+CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ResetPerformanceStatistics(
+    const CoSimIO_Info I_Info);
+
 CO_SIM_IO_NODISCARD CoSimIO_Info CoSimIO_ImportMesh(
     const CoSimIO_Info I_Info,
     CoSimIO_ModelPart O_ModelPart);
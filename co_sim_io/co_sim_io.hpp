@@ -47,6 +47,43 @@ Info CO_SIM_IO_API ExportData(
     const Info& I_Info,
     const TContainerType& rData);
 
+// imports data without copying it, "O_Data" points to memory owned by the CoSimIO
+// the data is valid until it is released with "ReleaseData"
+Info CO_SIM_IO_API BorrowData(
+    const Info& I_Info,
+    const double*& O_Data,
+    std::size_t& O_Size);
+
+Info CO_SIM_IO_API ReleaseData(
+    const Info& I_Info);
+
+// non-blocking versions of ImportData and ExportData, the returned Info contains the "request_id"
+// the data must stay alive and must not be accessed until the request is completed with "Wait"
+template<class TContainerType>
+Info CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    TContainerType& rData);
+
+template<class TContainerType>
+Info CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const TContainerType& rData);
+
+// blocks until the request is completed, returns the same Info as the blocking version
+Info CO_SIM_IO_API Wait(
+    const Info& I_Info);
+
+// checks without blocking whether the request is completed ("is_completed")
+Info CO_SIM_IO_API Test(
+    const Info& I_Info);
+
+// accumulated counters and timings of the operations of this rank, per identifier and operation
+Info CO_SIM_IO_API GetPerformanceStatistics(
+    const Info& I_Info);
+
+Info CO_SIM_IO_API ResetPerformanceStatistics(
+    const Info& I_Info);
+
 
 Info CO_SIM_IO_API ImportMesh(
     const Info& I_Info,
@@ -0,0 +1,91 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_ASYNC_REQUEST_INCLUDED
+#define CO_SIM_IO_ASYNC_REQUEST_INCLUDED
+
+// System includes
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+// Project includes
+#include "includes/info.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// handle of a non-blocking operation (e.g. ImportDataAsync)
+class CO_SIM_IO_API AsyncRequest
+{
+public:
+    virtual ~AsyncRequest() = default;
+
+    // checks without blocking whether the operation is completed
+    virtual bool Test() = 0;
+
+    // blocks until the operation is completed, errors of the operation are not thrown here
+    virtual void WaitForCompletion() = 0;
+
+    // returns the Info of the completed operation (same as for the blocking version)
+    // rethrows errors that happened during the operation
+    virtual Info GetInfo() = 0;
+};
+
+// request that is completed by an AsyncWorker
+class CO_SIM_IO_API FutureAsyncRequest : public AsyncRequest
+{
+public:
+    explicit FutureAsyncRequest(std::future<Info>&& rFuture)
+        : mFuture(std::move(rFuture)) {}
+
+    bool Test() override;
+
+    void WaitForCompletion() override;
+
+    Info GetInfo() override;
+
+private:
+    std::future<Info> mFuture;
+};
+
+// executes tasks one after another (in the order in which they are posted) in a separate thread
+class CO_SIM_IO_API AsyncWorker
+{
+public:
+    using TaskType = std::function<Info()>;
+
+    AsyncWorker();
+
+    // completes the tasks that are still queued
+    ~AsyncWorker();
+
+    std::future<Info> Post(TaskType Task);
+
+private:
+    std::deque<std::packaged_task<Info()>> mTasks;
+    bool mStop = false;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::thread mThread;
+
+    void Run();
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_ASYNC_REQUEST_INCLUDED
@@ -15,6 +15,10 @@
 
 // System includes
 #include <thread>
+#include <vector>
+#include <limits>
+#include <memory>
+#include <unordered_map>
 
 // Project includes
 #include "communication.hpp"
@@ -36,8 +40,7 @@ class CO_SIM_IO_API BaseSocketCommunication : public Communication
 public:
     BaseSocketCommunication(
         const Info& I_Settings,
-        std::shared_ptr<DataCommunicator> I_DataComm)
-        : Communication(I_Settings, I_DataComm) {}
+        std::shared_ptr<DataCommunicator> I_DataComm);
 
     ~BaseSocketCommunication() override;
 
@@ -50,6 +53,42 @@ protected:
     asio::io_context mAsioContext;
     std::thread mContextThread;
 
+    // asynchronous mode: the messages are sent and received in the background by the context thread
+    // sending returns once the data is queued, receiving takes the messages that were already read ahead
+    class AsyncIO;
+    bool mUseAsyncIO;
+    int mMaxQueuedMessages;
+    std::unique_ptr<AsyncIO> mpAsyncIO;
+    std::unique_ptr<asio::executor_work_guard<asio::io_context::executor_type>> mpWorkGuard;
+
+    // additional sockets, large data is striped across all sockets (including the main one)
+    std::vector<std::shared_ptr<TSocketType>> mAdditionalAsioSockets;
+    std::size_t mStripingThreshold = std::numeric_limits<std::size_t>::max();
+
+    // one socket per partner rank, used instead of the main socket if the partner runs with a different number of processes
+    std::unordered_map<int, std::shared_ptr<TSocketType>> mPartnerAsioSockets;
+
+    // socket options, applied to all sockets after they are connected
+    bool mTcpNoDelay;
+    int mSendBufferSize;
+    int mReceiveBufferSize;
+    int mBusyPoll;
+    bool mAutoTuneBuffers;
+
+    TSocketType& GetAsioSocket(const Info& I_Info);
+
+    // sets the socket options and (if requested) the buffer sizes determined by the probe, returns the values that are used
+    Info ConfigureSockets();
+
+    void ConfigureSocket(
+        TSocketType& rSocket,
+        const int SendBufferSize,
+        const int ReceiveBufferSize);
+
+    // measures the round trip time and the bandwidth of a socket to size the buffers according to the bandwidth-delay product
+    // the primary side measures and sends the results to the secondary side, such that both use the same buffer sizes
+    Info ProbeBandwidthDelayProduct(TSocketType& rSocket);
+
     double SendString(
         const Info& I_Info,
         const std::string& rData) override;
@@ -66,9 +105,32 @@ protected:
         const Info& I_Info,
         Internals::DataContainer<double>& rData) override;
 
-    void SendSize(const std::uint64_t Size);
+    void SendSize(
+        TSocketType& rSocket,
+        const std::uint64_t Size);
+
+    // sends the size followed by the data, both are written together if the data is not striped
+    void SendSizeAndData(
+        TSocketType& rSocket,
+        const std::uint64_t Size,
+        const char* pData,
+        const std::size_t NumBytes);
+
+    std::uint64_t ReceiveSize(TSocketType& rSocket);
+
+    void WriteData(
+        TSocketType& rSocket,
+        const char* pData,
+        const std::size_t NumBytes);
+
+    void ReadData(
+        TSocketType& rSocket,
+        char* pData,
+        const std::size_t NumBytes);
+
+    void DerivedHandShake() const override;
 
-    std::uint64_t ReceiveSize();
+    Info GetCommunicationSettings() const override;
 };
 
 } // namespace Internals
@@ -16,6 +16,12 @@
 // System includes
 #include <utility>
 #include <tuple>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <map>
+#include <memory>
 
 // Project includes
 #include "includes/info.hpp"
@@ -24,6 +30,9 @@
 #include "includes/data_communicator.hpp"
 #include "includes/filesystem_inc.hpp"
 #include "includes/utilities.hpp"
+#include "includes/communication/async_request.hpp"
+#include "includes/communication/performance_statistics.hpp"
+#include "includes/communication/tracer.hpp"
 
 namespace CoSimIO {
 namespace Internals {
@@ -47,18 +56,24 @@ public:
     Info ExportInfo(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ExportInfo", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Export);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Info \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportInfoImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ExportInfoMToN(std::forward<Args>(args)...) : ExportInfoImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Info " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Export info");
+        RecordStatistics(i_info, o_info, "export_info", start_time);
 
         return o_info;
     }
@@ -67,18 +82,24 @@ public:
     Info ImportInfo(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ImportInfo", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Import);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Info \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportInfoImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ImportInfoMToN(std::forward<Args>(args)...) : ImportInfoImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Info " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Import info");
+        RecordStatistics(i_info, o_info, "import_info", start_time);
 
         return o_info;
     }
@@ -87,18 +108,24 @@ public:
     Info ImportData(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ImportData", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Import);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Data \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportDataImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ImportDataMToN(std::forward<Args>(args)...) : ImportDataImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Data " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Import data");
+        RecordStatistics(i_info, o_info, "import_data", start_time);
 
         return o_info;
     }
@@ -107,38 +134,109 @@ public:
     Info ExportData(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ExportData", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Export);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Data \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportDataImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ExportDataMToN(std::forward<Args>(args)...) : ExportDataImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Data " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Export data");
+        RecordStatistics(i_info, o_info, "export_data", start_time);
 
         return o_info;
     }
 
+    // imports data without copying it to a container of the user
+    // the data stays valid until it is released with "ReleaseData"
+    template<class... Args>
+    Info BorrowData(Args&&... args)
+    {
+        const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "BorrowData", "operation", i_info.Get<std::string>("identifier"));
+
+        CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Import);
+
+        const std::string identifier = i_info.Get<std::string>("identifier");
+        CO_SIM_IO_ERROR_IF(mBorrowedIdentifiers.count(identifier) > 0) << "Data for \"" << identifier << "\" was already borrowed, it has to be released before it can be borrowed again!" << std::endl;
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Borrowing Data \"" << identifier << "\" ..." << std::endl;
+
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = BorrowDataImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
+
+        PostChecks(o_info);
+
+        mBorrowedIdentifiers.insert(identifier);
+
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished borrowing Data " << identifier << "\""<< std::endl;
+
+        PrintElapsedTime(i_info, o_info, "Borrow data");
+        RecordStatistics(i_info, o_info, "borrow_data", start_time);
+
+        return o_info;
+    }
+
+    Info ReleaseData(const Info& I_Info);
+
+    // non-blocking versions of ImportData and ExportData, the returned Info contains the "request_id"
+    // the data must not be accessed until the request is completed with "Wait"
+    Info ImportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<Internals::DataContainer<double>> pData);
+
+    Info ExportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData);
+
+    // blocks until the request is completed and returns the Info of the operation
+    Info Wait(const Info& I_Info);
+
+    // checks without blocking whether the request is completed ("is_completed")
+    Info Test(const Info& I_Info);
+
+    // the statistics of the operations of this rank, see "PerformanceStatistics"
+    Info GetPerformanceStatistics() const;
+
+    void ResetPerformanceStatistics();
+
+    // nullptr if tracing is disabled (setting "trace_file")
+    Tracer* GetTracer() const {return mpTracer.get();}
+
     template<class... Args>
     Info ImportMesh(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ImportMesh", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Import);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Importing Mesh \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ImportMeshImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ImportMeshMToN(std::forward<Args>(args)...) : ImportMeshImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished importing Mesh " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Import mesh");
+        RecordStatistics(i_info, o_info, "import_mesh", start_time);
 
         return o_info;
     }
@@ -147,18 +245,24 @@ public:
     Info ExportMesh(Args&&... args)
     {
         const Info i_info = std::get<0>(std::forward_as_tuple(args...));
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "ExportMesh", "operation", i_info.Get<std::string>("identifier"));
 
         CheckConnection(i_info);
+        CompletePendingRequests(AsyncDirection::Export);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Exporting Mesh \"" << i_info.Get<std::string>("identifier") << "\" ..." << std::endl;
 
-        Info o_info = ExportMeshImpl(std::forward<Args>(args)...);
+        WaitTimer::ExtractAccumulatedTime(); // discarding the time waited before this operation
+        Info o_info = mIsMToNConnection ? ExportMeshMToN(std::forward<Args>(args)...) : ExportMeshImpl(std::forward<Args>(args)...);
+        o_info.Set<double>("elapsed_time_wait", WaitTimer::ExtractAccumulatedTime());
 
         PostChecks(o_info);
 
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished exporting Mesh " << i_info.Get<std::string>("identifier") << "\""<< std::endl;
 
         PrintElapsedTime(i_info, o_info, "Export mesh");
+        RecordStatistics(i_info, o_info, "export_mesh", start_time);
 
         return o_info;
     }
@@ -174,10 +278,26 @@ protected:
     const DataCommunicator& GetDataCommunicator()  const {return *mpDataComm;}
     bool GetAlwaysUseSerializer() const        {return mAlwaysUseSerializer;}
     Serializer::TraceType GetSerializerTraceType() const {return mSerializerTraceType;}
+    Utilities::FileWaitStrategy GetFileWaitStrategy() const {return mFileWaitStrategy;}
 
     Info GetMyInfo() const;
     Info GetPartnerInfo() const {return mPartnerInfo;};
 
+    // whether the partner runs with a different number of processes (M:N)
+    // in this case the data is redistributed among the ranks, see "Utilities::ComputePartnerRanksAsImporter/Exporter"
+    bool GetIsMToNConnection() const {return mIsMToNConnection;}
+
+    // the partner ranks from which this rank imports (can be none) and to which it exports (always one)
+    const std::vector<int>& GetPartnerRanksAsImporter() const {return mPartnerRanksAsImporter;}
+    const std::vector<int>& GetPartnerRanksAsExporter() const {return mPartnerRanksAsExporter;}
+
+    // all partner ranks this rank exchanges data with, in ascending order
+    std::vector<int> GetConnectedPartnerRanks() const;
+
+    // the partner rank that an operation is performed with
+    // this is the own rank, unless the partner runs with a different number of processes
+    int GetPartnerRank(const Info& I_Info) const;
+
     fs::path GetTmpFileName(
         const fs::path& rPath,
         const bool UseAuxFileForFileAvailability=true) const;
@@ -215,6 +335,26 @@ protected:
         const Info& I_Info,
         const Internals::DataContainer<double>& rData);
 
+    // the default implementation imports into an internal buffer (one per identifier) and exposes it
+    // communications that can expose the data of the partner directly override this
+    virtual Info BorrowDataImpl(
+        const Info& I_Info,
+        const double*& O_Data,
+        std::size_t& O_Size);
+
+    virtual Info ReleaseDataImpl(const Info& I_Info) {return Info();}
+
+    // the default implementation executes ImportDataImpl/ExportDataImpl in a background thread
+    // there is one thread per direction, such that an import and an export can progress at the same time
+    // hence the communications have to support that one thread imports while another one exports
+    virtual std::unique_ptr<AsyncRequest> ImportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<Internals::DataContainer<double>> pData);
+
+    virtual std::unique_ptr<AsyncRequest> ExportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData);
+
     virtual Info ImportMeshImpl(
         const Info& I_Info,
         ModelPart& O_ModelPart);
@@ -234,11 +374,18 @@ protected:
 
         const auto start_time(std::chrono::steady_clock::now());
         StreamSerializer serializer(mSerializerTraceType);
-        serializer.save("object", rObject);
+        {
+            TraceScope trace_scope(GetTracer(), "serialize", "phase");
+            serializer.save("object", rObject);
+        }
         const double elapsed_time_save = Utilities::ElapsedSeconds(start_time);
 
         const std::string& data = serializer.GetStringRepresentation();
-        const double elapsed_time_write = SendString(I_Info, data);
+        double elapsed_time_write;
+        {
+            TraceScope trace_scope(GetTracer(), "transfer", "phase");
+            elapsed_time_write = SendString(I_Info, data);
+        }
 
         info.Set<double>("elapsed_time", elapsed_time_write+elapsed_time_save);
         info.Set<double>("elapsed_time_ipc", elapsed_time_write);
@@ -260,11 +407,18 @@ protected:
         Info info;
 
         std::string buffer;
-        const double elapsed_time_read = ReceiveString(I_Info, buffer);
+        double elapsed_time_read;
+        {
+            TraceScope trace_scope(GetTracer(), "transfer", "phase");
+            elapsed_time_read = ReceiveString(I_Info, buffer);
+        }
 
         const auto start_time(std::chrono::steady_clock::now());
-        StreamSerializer serializer(buffer, mSerializerTraceType);
-        serializer.load("object", rObject);
+        {
+            TraceScope trace_scope(GetTracer(), "deserialize", "phase");
+            StreamSerializer serializer(buffer, mSerializerTraceType);
+            serializer.load("object", rObject);
+        }
         const double elapsed_time_load = Utilities::ElapsedSeconds(start_time);
 
         info.Set<double>("elapsed_time", elapsed_time_read+elapsed_time_load);
@@ -302,10 +456,15 @@ private:
 
     Info mPartnerInfo;
 
+    bool mIsMToNConnection = false;
+    std::vector<int> mPartnerRanksAsImporter;
+    std::vector<int> mPartnerRanksAsExporter;
+
     fs::path mCommFolder;
     bool mCommInFolder = true;
     bool mAlwaysUseSerializer = false;
     Serializer::TraceType mSerializerTraceType = Serializer::TraceType::SERIALIZER_NO_TRACE;
+    Utilities::FileWaitStrategy mFileWaitStrategy = Utilities::FileWaitStrategy::Polling;
 
     fs::path mWorkingDirectory;
     int mEchoLevel = 1;
@@ -314,10 +473,66 @@ private:
     bool mPrintTiming = false;
     bool mIsConnected = false;
 
+    PerformanceStatistics mPerformanceStatistics;
+    std::unique_ptr<Tracer> mpTracer;
+
+    std::unordered_set<std::string> mBorrowedIdentifiers;
+    std::unordered_map<std::string, std::vector<double>> mBorrowBuffers;
+
+    enum class AsyncDirection {Import, Export};
+
+    struct PendingRequest
+    {
+        AsyncDirection Direction;
+        Info InputInfo;
+        std::unique_ptr<AsyncRequest> pRequest;
+    };
+
+    // ordered by the request id, i.e. the order in which the requests were started
+    std::map<int, PendingRequest> mPendingRequests;
+    int mNextRequestId = 0;
+
+    std::unique_ptr<AsyncWorker> mpImportWorker;
+    std::unique_ptr<AsyncWorker> mpExportWorker;
+
+    // the requests of one direction are completed in the order in which they were started
+    // this also has to be done before a blocking operation in the same direction
+    void CompletePendingRequests(
+        const AsyncDirection Direction,
+        const int UntilRequestId=-1);
+
+    Info StartAsyncRequest(
+        const Info& I_Info,
+        const AsyncDirection Direction,
+        std::unique_ptr<AsyncRequest> pRequest);
+
+    // the exporting ranks send to their partner rank, the importing ranks receive from all of their partner ranks
+    // the received segments of data are concatenated and the mesh chunks are merged
+    Info ImportInfoMToN(const Info& I_Info);
+
+    Info ExportInfoMToN(const Info& I_Info);
+
+    Info ImportDataMToN(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData);
+
+    Info ExportDataMToN(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData);
+
+    Info ImportMeshMToN(
+        const Info& I_Info,
+        ModelPart& O_ModelPart);
+
+    Info ExportMeshMToN(
+        const Info& I_Info,
+        const ModelPart& I_ModelPart);
+
     void CheckConnection(const Info& I_Info);
     void PostChecks(const Info& I_Info);
     virtual std::string GetCommunicationName() const = 0;
     virtual Info GetCommunicationSettings() const {return Info();}
+    virtual bool SupportsDifferentNumberOfProcesses() const {return false;}
 
     virtual void BaseConnectDetail(const Info& I_Info);
     virtual void BaseDisconnectDetail(const Info& I_Info);
@@ -333,6 +548,12 @@ private:
         const Info& I_Info,
         const Info& O_Info,
         const std::string& rLabel);
+
+    void RecordStatistics(
+        const Info& I_Info,
+        const Info& O_Info,
+        const std::string& rOperation,
+        const std::chrono::steady_clock::time_point& rStartTime);
 };
 
 } // namespace Internals
@@ -14,6 +14,14 @@
 #define CO_SIM_IO_FILE_COMMUNICATION_INCLUDED
 
 // System includes
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 // Project includes
 #include "communication.hpp"
@@ -38,11 +46,126 @@ public:
     ~FileCommunication() override;
 
 private:
+// writes files in a background thread, such that sending does not block until the partner has read the previous file
+// the files of one identifier are written in order, and at most "MaxQueueSize" files per identifier can be pending
+class AsyncFileWriter
+{
+public:
+    using WriteFunctionType = std::function<void()>;
+
+    explicit AsyncFileWriter(const std::size_t MaxQueueSize);
+
+    ~AsyncFileWriter();
+
+    // blocks if the queue of this identifier is full
+    void Push(
+        const std::string& rIdentifier,
+        const fs::path& rFileName,
+        WriteFunctionType WriteFunction);
+
+    // blocks until all files are written, rethrows errors that happened while writing
+    void Flush();
+
+    void Stop();
+
+private:
+    struct Job
+    {
+        fs::path FileName;
+        WriteFunctionType Write;
+    };
+
+    const std::size_t mMaxQueueSize;
+    std::unordered_map<std::string, std::deque<Job>> mQueues;
+    std::size_t mNumPendingJobs = 0;
+    bool mStop = false;
+    std::exception_ptr mpException;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::thread mThread;
+
+    void Run();
+
+    void ThrowIfFailed();
+};
+
+// file that is mapped into memory and reused for all exchanges of one identifier
+// a sequence counter in the header of the file indicates whether it contains data (odd) or is free (even)
+class MappedFile
+{
+public:
+    explicit MappedFile(const fs::path& rPath);
+
+    ~MappedFile();
+
+    void WaitUntilFree();
+
+    // the file has to be free
+    void Write(const char* pData, const std::size_t Size);
+
+    // waits until the file contains data and returns its size, the data can be accessed with "GetData"
+    std::size_t WaitForData();
+
+    const char* GetData() const;
+
+    // marks the data as read, such that the file can be written again
+    void Release();
+
+    // whether this process created the file (and hence has to remove it)
+    bool IsOwner() const {return mIsOwner;}
+
+    const fs::path& GetPath() const {return mPath;}
+
+private:
+    struct Header;
+
+    fs::path mPath;
+    bool mIsOwner = false;
+    int mFileDescriptor = -1;
+    std::size_t mMappedSize = 0;
+    char* mpMapped = nullptr;
+
+    Header& GetHeader() const;
+
+    // increases the size of the file (only if needed) and maps it with the new size
+    void Resize(const std::size_t Size);
+
+    void Map(const std::size_t Size);
+};
+
     bool mUseAuxFileForFileAvailability = USE_AUX_FILE_FOR_FILE_AVAILABILITY;
+    const bool mUseMmap = false;
     const bool mUseFileSerializer = true;
+    const bool mUseAsyncSend = false;
+    const int mMaxQueuedSends;
+
+    std::unique_ptr<AsyncFileWriter> mpAsyncFileWriter;
+
+    std::unordered_map<std::string, std::unique_ptr<MappedFile>> mMappedFiles; // key is the name of the file
+    std::mutex mMappedFilesMutex; // asynchronous imports and exports access the map concurrently
 
     std::string GetCommunicationName() const override {return "file";}
 
+    bool SupportsDifferentNumberOfProcesses() const override {return true;}
+
+    Info ConnectDetail(const Info& I_Info) override;
+
+    Info DisconnectDetail(const Info& I_Info) override;
+
+    fs::path GetDataFileName(
+        const std::string& rPrefix,
+        const std::string& rIdentifier,
+        const int PartnerRank,
+        const bool IsSending) const;
+
+    MappedFile& GetMappedFile(const fs::path& rFileName);
+
+    void QueueFileForWriting(
+        const std::string& rIdentifier,
+        const fs::path& rFileName,
+        std::shared_ptr<const std::string> pContent);
+
     void DerivedHandShake() const override;
 
     Info GetCommunicationSettings() const override;
@@ -0,0 +1,108 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_PERFORMANCE_STATISTICS_INCLUDED
+#define CO_SIM_IO_PERFORMANCE_STATISTICS_INCLUDED
+
+// System includes
+#include <array>
+#include <chrono>
+#include <map>
+#include <string>
+
+// Project includes
+#include "includes/info.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// accumulates the timings of the operations of a connection, separately for each identifier and operation (e.g. "export_data")
+// the time of an operation is split into waiting (for the partner), serializing and transferring the data
+class CO_SIM_IO_API PerformanceStatistics
+{
+public:
+    // the histograms have logarithmic bins: bin 0 counts the durations below 1 microsecond,
+    // bin i counts the durations in [2^(i-1), 2^i) microseconds and the last bin counts all longer durations
+    static constexpr std::size_t NumberOfHistogramBins = 28;
+
+    // "ElapsedTime" is the whole duration of the operation, "WaitTime" the part of it that was spent waiting
+    // the times for serializing and transferring are taken from the Info returned by the operation
+    void Record(
+        const std::string& rIdentifier,
+        const std::string& rOperation,
+        const double ElapsedTime,
+        const double WaitTime,
+        const Info& O_Info);
+
+    // returns one Info per identifier, which contains one Info per operation
+    Info GetInfo() const;
+
+    void Reset();
+
+private:
+    class TimeStatistics
+    {
+    public:
+        void Add(const double Time);
+
+        Info GetInfo() const;
+
+    private:
+        double mTotal = 0.0;
+        double mMin = 0.0;
+        double mMax = 0.0;
+        bool mIsEmpty = true;
+        std::array<int, NumberOfHistogramBins> mHistogram {};
+    };
+
+    struct OperationStatistics
+    {
+        int Count = 0;
+        double Bytes = 0.0; // double such that it can also be accessed from C and Python
+        TimeStatistics Time;
+        TimeStatistics Wait;
+        TimeStatistics Serialize;
+        TimeStatistics Transfer;
+    };
+
+    // ordered such that the output is reproducible
+    std::map<std::string, std::map<std::string, OperationStatistics>> mStatistics;
+};
+
+// measures the time from its construction to its destruction, in which the current thread is blocked waiting for the partner
+// the communications use it e.g. around receiving the size of a message, the time is reported as "elapsed_time_wait" of the operation
+// the time is accumulated per thread, such that it can be used everywhere in the communications (also in the background threads)
+// if tracing is enabled, the span is also added as "wait" phase to the Tracer that is active in the current thread
+class CO_SIM_IO_API WaitTimer
+{
+public:
+    WaitTimer() : mStartTime(std::chrono::steady_clock::now()) {}
+
+    ~WaitTimer();
+
+    WaitTimer(const WaitTimer&) = delete;
+    WaitTimer& operator=(const WaitTimer&) = delete;
+
+    // the time the current thread waited since the last call to "ExtractAccumulatedTime"
+    static double GetAccumulatedTime();
+
+    // same as "GetAccumulatedTime", afterwards the time is reset
+    static double ExtractAccumulatedTime();
+
+private:
+    std::chrono::steady_clock::time_point mStartTime;
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_PERFORMANCE_STATISTICS_INCLUDED
@@ -40,6 +40,7 @@ public:
         const fs::path& rBasePipeName,
         const bool IsPrimary,
         const int BufferSize,
+        const bool UseVmsplice,
         const int EchoLevel);
 
     template<typename TDataType>
@@ -49,21 +50,18 @@ public:
 
         #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
         const std::size_t data_size = rData.size();
-        std::size_t written_size=0;
-        SendSize(data_size); // serves also as synchronization for time measurement
+        const std::size_t data_size_bytes = data_size*SizeDataType;
+        const bool use_vmsplice = UseVmspliceForSize(data_size_bytes);
+        SendSize(data_size, use_vmsplice); // serves also as synchronization for time measurement
 
         const auto start_time(std::chrono::steady_clock::now());
-        const std::size_t buffer_size = mBufferSize/SizeDataType;
 
-        while(written_size<data_size) {
-            const std::size_t data_left_to_write = data_size - written_size;
-            const std::size_t current_buffer_size = data_left_to_write > buffer_size ? buffer_size : data_left_to_write;
-
-            const ssize_t bytes_written = write(mPipeHandleWrite, &rData[written_size], current_buffer_size*SizeDataType);
-            CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
-
-            written_size += current_buffer_size;
+        if (use_vmsplice) {
+            WriteVmsplice(reinterpret_cast<const char*>(&rData[0]), data_size_bytes);
+        } else if (data_size_bytes > 0) {
+            WriteBytes(reinterpret_cast<const char*>(&rData[0]), data_size_bytes);
         }
+
         return Utilities::ElapsedSeconds(start_time);
         #else
         return 0.0;
@@ -79,22 +77,19 @@ public:
         CO_SIM_IO_TRY
 
         #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-        std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
-        std::size_t read_size=0;
+        bool ack_requested;
+        std::size_t received_size = ReceiveSize(ack_requested); // serves also as synchronization for time measurement
 
         const auto start_time(std::chrono::steady_clock::now());
         rData.resize(received_size);
-        const std::size_t buffer_size = mBufferSize/SizeDataType;
+        const std::size_t received_size_bytes = received_size*SizeDataType;
 
-        while(read_size<received_size) {
-            const std::size_t data_left_to_read = received_size - read_size;
-            const std::size_t current_buffer_size = data_left_to_read > buffer_size ? buffer_size : data_left_to_read;
+        if (received_size_bytes > 0) {
+            ReadBytes(reinterpret_cast<char*>(&rData[0]), received_size_bytes);
+        }
 
-            const ssize_t bytes_written = read(mPipeHandleRead, &rData[read_size], current_buffer_size*SizeDataType);
-            CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in reading from Pipe!" << std::endl;
+        if (ack_requested) {SendAck();}
 
-            read_size += current_buffer_size;
-        }
         return Utilities::ElapsedSeconds(start_time);
         #else
         return 0.0;
@@ -111,21 +106,44 @@ private:
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
     int mPipeHandleWrite;
     int mPipeHandleRead;
+
+    // the reader of data that was written with vmsplice confirms through these pipes that it has read everything
+    int mPipeHandleAckWrite = -1;
+    int mPipeHandleAckRead = -1;
     #endif
 
     fs::path mPipeNameWrite;
     fs::path mPipeNameRead;
 
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-    std::size_t mBufferSize;
+    // the data is transferred in chunks of the size of the respective pipe
+    std::size_t mChunkSizeWrite;
+    std::size_t mChunkSizeRead;
     #endif
 
-    void SendSize(const std::uint64_t Size);
+    bool mUseVmsplice;
+
+    // the highest bit of the size tells the reader to confirm that it has read the data
+    void SendSize(const std::uint64_t Size, const bool RequestAck);
+
+    std::uint64_t ReceiveSize(bool& rAckRequested);
+
+    // the pipe might transfer less than requested, hence these functions continue until everything is transferred
+    void WriteBytes(const char* pData, const std::size_t SizeBytes);
+
+    void ReadBytes(char* pData, const std::size_t SizeBytes);
+
+    // vmsplice is only used for data that does not fit into the pipe, as the writer has to wait for the reader anyway in this case
+    bool UseVmspliceForSize(const std::size_t SizeBytes) const;
+
+    // maps the pages of the data into the pipe instead of copying them, and waits until the reader has read them
+    void WriteVmsplice(const char* pData, const std::size_t SizeBytes);
 
-    std::uint64_t ReceiveSize();
+    void SendAck();
 };
 
     const std::size_t mBufferSize;
+    const bool mUseVmsplice;
 
     std::shared_ptr<BidirectionalPipe> mpPipe;
 
@@ -0,0 +1,141 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
+#define CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
+
+// System includes
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Project includes
+#include "communication.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+class CO_SIM_IO_API SharedMemoryCommunication : public Communication
+{
+public:
+    SharedMemoryCommunication(
+        const Info& I_Settings,
+        std::shared_ptr<DataCommunicator> I_DataComm);
+
+    ~SharedMemoryCommunication() override;
+
+private:
+// single-producer/single-consumer ring buffer living in a shared memory segment
+// one process writes and the other one reads, hence one is needed per direction
+class RingBuffer
+{
+public:
+    RingBuffer(
+        const std::string& rName,
+        const std::size_t Capacity,
+        const bool Create);
+
+    void Write(const void* pData, const std::size_t Size);
+
+    void Read(void* pData, const std::size_t Size);
+
+    // returns a pointer to the data inside the buffer, the data is not removed from the buffer
+    // until "Release" is called. Returns nullptr if the data is too large for the buffer
+    const void* Borrow(const std::size_t Size);
+
+    void Release();
+
+    void Close();
+
+    // removes the name of the segment, existing mappings stay valid
+    void Unlink();
+
+private:
+    struct Header;
+
+    // all data starts at aligned positions, such that borrowed data can be used directly
+    static constexpr std::size_t sAlignment = 8;
+
+    std::string mName;
+    std::size_t mCapacity = 0;
+    std::size_t mMappedSize = 0;
+    Header* mpHeader = nullptr;
+    char* mpData = nullptr;
+    std::size_t mBorrowedSize = 0;
+
+    std::size_t GetSkipSize(
+        const std::uint64_t Position,
+        const std::size_t Size) const;
+
+    std::size_t GetPaddingSize(const std::size_t Size) const;
+
+    // these advance the respective position by "Size" once possible and return the new position
+    std::uint64_t WaitForFreeSpace(
+        const std::uint64_t WritePosition,
+        const std::size_t Size);
+
+    std::uint64_t WaitForAvailableData(
+        const std::uint64_t ReadPosition,
+        const std::size_t Size);
+};
+
+    const std::size_t mBufferSize;
+
+    std::unique_ptr<RingBuffer> mpWriteBuffer;
+    std::unique_ptr<RingBuffer> mpReadBuffer;
+
+    std::vector<double> mBorrowBuffer; // used if data cannot be borrowed from the ring buffer directly
+
+    std::string GetCommunicationName() const override {return "shm";}
+
+    Info ConnectDetail(const Info& I_Info) override;
+
+    Info DisconnectDetail(const Info& I_Info) override;
+
+    double SendString(
+        const Info& I_Info,
+        const std::string& rData) override;
+
+    double ReceiveString(
+        const Info& I_Info,
+        std::string& rData) override;
+
+    double SendDataContainer(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData) override;
+
+    double ReceiveDataContainer(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData) override;
+
+    Info BorrowDataImpl(
+        const Info& I_Info,
+        const double*& O_Data,
+        std::size_t& O_Size) override;
+
+    Info ReleaseDataImpl(const Info& I_Info) override;
+
+    void DerivedHandShake() const override;
+
+    Info GetCommunicationSettings() const override;
+
+    std::string GetSegmentName(const std::string& rDirection) const;
+
+    void SendSize(const std::uint64_t Size);
+
+    std::uint64_t ReceiveSize();
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_SHARED_MEMORY_COMMUNICATION_INCLUDED
@@ -37,14 +37,23 @@ private:
     unsigned short mPortNumber=0;
     std::string mIpAddress;
     std::string mSerializedConnectionInfo;
+    int mNumStreams;
 
     std::string GetCommunicationName() const override {return "socket";}
 
+    // with a different number of processes each rank connects one socket per partner rank, which is not combined with striping and asynchronous I/O
+    bool SupportsDifferentNumberOfProcesses() const override {return mNumStreams == 1 && !mUseAsyncIO;}
+
     void PrepareConnection(const Info& I_Info) override;
 
+    void DerivedHandShake() const override;
+
     Info GetCommunicationSettings() const override;
 
-    void GetConnectionInformation();
+    // sets the IP address and port number of the given partner rank
+    void GetConnectionInformation(const int PartnerRank);
+
+    void ConnectPartnerRanks();
 };
 
 } // namespace Internals
@@ -0,0 +1,139 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_TRACER_INCLUDED
+#define CO_SIM_IO_TRACER_INCLUDED
+
+// System includes
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include "includes/define.hpp"
+#include "includes/filesystem_inc.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// records the spans of the events of a connection (e.g. the phases of an ExportData) and writes them to a file in the Chrome trace format
+// the file can be viewed with "chrome://tracing" or https://ui.perfetto.dev
+// the timestamps are microseconds since the epoch, such that the traces of different processes can be shown on one timeline
+// the events can be added from multiple threads
+// the events are buffered and appended to the file once the buffer is full, such that the memory usage is bounded also for long runs
+class CO_SIM_IO_API Tracer
+{
+public:
+    static constexpr std::size_t MaxBufferedEvents = 10000;
+
+    Tracer(
+        const fs::path& rFileName,
+        const std::string& rProcessName);
+
+    void AddEvent(
+        const std::string& rName,
+        const std::string& rCategory,
+        const std::string& rDetail,
+        const std::chrono::steady_clock::time_point& rStartTime,
+        const std::chrono::steady_clock::time_point& rEndTime);
+
+    // writes the remaining events and completes the file, events that are added afterwards are ignored
+    void WriteFile();
+
+    const fs::path& GetFileName() const {return mFileName;}
+
+    // the Tracer of the innermost TraceScope of the current thread (nullptr if there is none)
+    // this way also code without access to the Communication can add events (e.g. WaitTimer)
+    static Tracer* GetActive();
+
+private:
+    struct Event
+    {
+        std::string Name;
+        std::string Category;
+        std::string Detail;
+        double Timestamp; // [us]
+        double Duration;  // [us]
+        int ThreadIndex;
+    };
+
+    fs::path mFileName;
+    std::string mProcessName;
+
+    // used to convert the (monotonic) steady clock to the wall clock
+    std::chrono::steady_clock::time_point mSteadyReferenceTime;
+    double mSystemReferenceTime; // [us] since the epoch
+
+    mutable std::mutex mMutex;
+    std::vector<Event> mEvents;
+    std::map<std::thread::id, int> mThreadIndices; // the threads are numbered in the order in which they added their first event
+    std::ofstream mFile;
+    bool mIsCompleted = false;
+
+    // appends the buffered events to the file (which is opened at the first call), the mutex has to be locked
+    void FlushEvents();
+
+    static Tracer*& ActiveTracer();
+
+    friend class TraceScope;
+};
+
+// records the span from its construction to its destruction, does nothing if no Tracer is given (i.e. tracing is disabled)
+// while it exists, the given Tracer is the active one of the current thread
+class CO_SIM_IO_API TraceScope
+{
+public:
+    TraceScope(
+        Tracer* pTracer,
+        const char* pName,
+        const char* pCategory,
+        const std::string& rDetail="")
+        : mpTracer(pTracer)
+    {
+        if (mpTracer) {
+            mName = pName;
+            mCategory = pCategory;
+            mDetail = rDetail;
+            mpPreviousActiveTracer = Tracer::ActiveTracer();
+            Tracer::ActiveTracer() = mpTracer;
+            mStartTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (mpTracer) {
+            mpTracer->AddEvent(mName, mCategory, mDetail, mStartTime, std::chrono::steady_clock::now());
+            Tracer::ActiveTracer() = mpPreviousActiveTracer;
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    Tracer* mpTracer;
+    Tracer* mpPreviousActiveTracer = nullptr;
+    std::string mName;
+    std::string mCategory;
+    std::string mDetail;
+    std::chrono::steady_clock::time_point mStartTime;
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_TRACER_INCLUDED
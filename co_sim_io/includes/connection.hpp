@@ -75,6 +75,51 @@ public:
         return mpComm->ExportData(std::forward<Args>(args)...);
     }
 
+    template<class... Args>
+    Info BorrowData(Args&&... args)
+    {
+        return mpComm->BorrowData(std::forward<Args>(args)...);
+    }
+
+    Info ReleaseData(const Info& I_Info)
+    {
+        return mpComm->ReleaseData(I_Info);
+    }
+
+    Info ImportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<DataContainer<double>> pData)
+    {
+        return mpComm->ImportDataAsync(I_Info, pData);
+    }
+
+    Info ExportDataAsync(
+        const Info& I_Info,
+        std::shared_ptr<const DataContainer<double>> pData)
+    {
+        return mpComm->ExportDataAsync(I_Info, pData);
+    }
+
+    Info Wait(const Info& I_Info)
+    {
+        return mpComm->Wait(I_Info);
+    }
+
+    Info Test(const Info& I_Info)
+    {
+        return mpComm->Test(I_Info);
+    }
+
+    Info GetPerformanceStatistics() const
+    {
+        return mpComm->GetPerformanceStatistics();
+    }
+
+    void ResetPerformanceStatistics()
+    {
+        mpComm->ResetPerformanceStatistics();
+    }
+
     template<class... Args>
     Info ImportMesh(Args&&... args)
     {
@@ -704,7 +704,7 @@ class DataCommunicator
             {
                 StreamSerializer send_serializer;
                 send_serializer.save("data", rBroadcastObject);
-                broadcast_message = send_serializer.GetStringRepresentation();
+                broadcast_message = send_serializer.ExtractStringRepresentation();
 
                 message_size = static_cast<unsigned int>(broadcast_message.size());
             }
@@ -781,7 +781,7 @@ class DataCommunicator
         {
             StreamSerializer send_serializer;
             send_serializer.save("data", rSendObject);
-            std::string send_message = send_serializer.GetStringRepresentation();
+            std::string send_message = send_serializer.ExtractStringRepresentation();
 
             std::string recv_message = this->SendRecv(send_message, SendDestination, RecvSource);
 
@@ -826,7 +826,7 @@ class DataCommunicator
         {
             StreamSerializer send_serializer;
             send_serializer.save("data", rSendObject);
-            std::string send_message = send_serializer.GetStringRepresentation();
+            std::string send_message = send_serializer.ExtractStringRepresentation();
 
             this->SendImpl(send_message, SendDestination, SendTag);
         }
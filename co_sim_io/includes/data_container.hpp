@@ -63,10 +63,9 @@ private:
     {
         CO_SIM_IO_TRY
 
+        // the values are saved as one block, in binary mode the format is the same as saving them one by one
         rSerializer.save("size", size());
-        for (std::size_t i=0; i<size(); ++i) {
-            rSerializer.save("v", data()[i]);
-        }
+        rSerializer.save_contiguous("values", data(), size());
 
         CO_SIM_IO_CATCH
     }
@@ -81,9 +80,7 @@ private:
             resize(new_size);
         }
 
-        for (std::size_t i=0; i<size(); ++i) {
-            rSerializer.load("v", data()[i]);
-        }
+        rSerializer.load_contiguous("values", data(), size());
 
         CO_SIM_IO_CATCH
     }
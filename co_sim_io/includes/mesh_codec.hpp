@@ -0,0 +1,59 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_MESH_CODEC_INCLUDED
+#define CO_SIM_IO_MESH_CODEC_INCLUDED
+
+// System includes
+
+// Project includes
+#include "define.hpp"
+#include "model_part.hpp"
+#include "serializer.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+// Serializes a ModelPart as flat arrays (structure of arrays) for exchanging meshes:
+// node ids, coordinates (X, Y, Z), partition indices of ghost nodes, element ids, element types and connectivities
+// This is much faster than serializing the ModelPart itself, which saves every node and element individually
+// and tracks the pointers to the nodes. On loading the ModelPart is rebuilt with the bulk creation functions
+class CO_SIM_IO_API MeshCodec
+{
+public:
+    // for saving
+    explicit MeshCodec(const ModelPart& I_ModelPart)
+        : mpConstModelPart(&I_ModelPart) {}
+
+    // for loading, the existing nodes and elements in the ModelPart are removed
+    explicit MeshCodec(ModelPart& O_ModelPart)
+        : mpConstModelPart(&O_ModelPart), mpModelPart(&O_ModelPart) {}
+
+    // delete copy and assignment CTor
+    MeshCodec(const MeshCodec&) = delete;
+    MeshCodec& operator=(MeshCodec const&) = delete;
+
+private:
+    const ModelPart* mpConstModelPart;
+    ModelPart* mpModelPart = nullptr;
+
+    friend class Serializer;
+
+    void save(Serializer& rSerializer) const;
+
+    void load(Serializer& rSerializer);
+};
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_MESH_CODEC_INCLUDED
@@ -0,0 +1,142 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+#ifndef CO_SIM_IO_POINTER_HASH_MAP_INCLUDED
+#define CO_SIM_IO_POINTER_HASH_MAP_INCLUDED
+
+// System includes
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+// Project includes
+
+namespace CoSimIO {
+namespace Internals {
+
+// Hash map with pointers as keys, used by the Serializer for keeping track of the saved and loaded pointers
+// Uses open addressing with linear probing, which is much more cache friendly than std::map or std::unordered_map
+// nullptr cannot be used as key, it marks empty slots. Entries cannot be removed individually
+template<class TValueType>
+class PointerHashMap
+{
+public:
+    using KeyType = const void*;
+
+    std::size_t size() const {return mSize;}
+
+    bool empty() const {return mSize == 0;}
+
+    // makes sure that "NumEntries" can be stored without rehashing
+    void reserve(const std::size_t NumEntries)
+    {
+        std::size_t required_capacity = sMinCapacity;
+        while (required_capacity*sMaxLoadFactorNumerator < NumEntries*sMaxLoadFactorDenominator) {
+            required_capacity *= 2;
+        }
+
+        if (required_capacity > mEntries.size()) {
+            Rehash(required_capacity);
+        }
+    }
+
+    // returns the value of the key, or nullptr if the key does not exist
+    // the returned pointer is invalidated by inserting
+    TValueType* find(KeyType Key)
+    {
+        if (mEntries.empty()) {return nullptr;}
+
+        Entry& r_entry = FindSlot(Key);
+        return (r_entry.Key == Key) ? &r_entry.Value : nullptr;
+    }
+
+    // inserts the value if the key does not exist yet
+    // returns whether the value was inserted
+    bool insert(KeyType Key, const TValueType& rValue)
+    {
+        reserve(mSize+1);
+
+        Entry& r_entry = FindSlot(Key);
+        if (r_entry.Key == Key) {return false;}
+
+        r_entry.Key = Key;
+        r_entry.Value = rValue;
+        ++mSize;
+        return true;
+    }
+
+    void clear()
+    {
+        mEntries.clear();
+        mSize = 0;
+    }
+
+private:
+    struct Entry
+    {
+        KeyType Key = nullptr;
+        TValueType Value = TValueType();
+    };
+
+    // the capacity is always a power of 2, such that the slot can be computed with a bitmask
+    // max load factor is 1/2, as linear probing degrades quickly for higher load factors
+    static constexpr std::size_t sMinCapacity = 16;
+    static constexpr std::size_t sMaxLoadFactorNumerator = 1;
+    static constexpr std::size_t sMaxLoadFactorDenominator = 2;
+
+    std::vector<Entry> mEntries;
+    std::size_t mSize = 0;
+
+    // the lower bits of pointers are mostly zero due to alignment, hence mixing the bits (finalizer of MurmurHash3)
+    static std::size_t Hash(KeyType Key)
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(Key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    // returns the slot with the key, or the empty slot where it would be inserted
+    Entry& FindSlot(KeyType Key)
+    {
+        const std::size_t mask = mEntries.size()-1;
+        std::size_t slot = Hash(Key) & mask;
+        while (mEntries[slot].Key != nullptr && mEntries[slot].Key != Key) {
+            slot = (slot+1) & mask;
+        }
+        return mEntries[slot];
+    }
+
+    void Rehash(const std::size_t NewCapacity)
+    {
+        std::vector<Entry> old_entries(NewCapacity);
+        old_entries.swap(mEntries);
+
+        for (const auto& r_entry : old_entries) {
+            if (r_entry.Key != nullptr) {
+                FindSlot(r_entry.Key) = r_entry;
+            }
+        }
+    }
+};
+
+template<class TValueType> constexpr std::size_t PointerHashMap<TValueType>::sMinCapacity;
+template<class TValueType> constexpr std::size_t PointerHashMap<TValueType>::sMaxLoadFactorNumerator;
+template<class TValueType> constexpr std::size_t PointerHashMap<TValueType>::sMaxLoadFactorDenominator;
+
+} // namespace Internals
+} // namespace CoSimIO
+
+#endif // CO_SIM_IO_POINTER_HASH_MAP_INCLUDED
@@ -27,9 +27,11 @@
 #include <array>
 #include <vector>
 #include <utility>
+#include <type_traits>
 
 // Project includes
 #include "define.hpp"
+#include "pointer_hash_map.hpp"
 
 #define CO_SIM_IO_SERIALIZATION_DIRECT_LOAD(type)                    \
     void load(std::string const & rTag, type& rValue)                \
@@ -108,13 +110,14 @@ public:
 
     typedef void* (*ObjectFactoryType)();
 
-    typedef std::map<void*, void*> LoadedPointersContainerType;
+    typedef PointerHashMap<void*> LoadedPointersContainerType;
 
     typedef std::map<std::string, ObjectFactoryType> RegisteredObjectsContainerType;
 
     typedef std::map<std::string, std::string> RegisteredObjectsNameContainerType;
 
-    typedef std::set<const void*> SavedPointersContainerType;
+    // the value is not used, only the keys are relevant
+    typedef PointerHashMap<bool> SavedPointersContainerType;
 
     typedef std::iostream BufferType;
 
@@ -159,6 +162,11 @@ public:
 
     static Serializer::TraceType StringToTraceType(const std::string& Trace);
 
+    /// Version of the tags that are written in the modes SERIALIZER_TRACE_ERROR and SERIALIZER_TRACE_ALL
+    /// 1: one tag per value of contiguous data, 2: one tag for all values (see "save_contiguous")
+    /// The formats without tags are not affected
+    static int GetTraceFormatVersion() {return 2;}
+
     void SetBuffer(BufferType* pBuffer)
     {
         mpBuffer = pBuffer;
@@ -194,8 +202,8 @@ public:
         if(pointer_type != SP_INVALID_POINTER)
         {
             read(p_pointer);
-            LoadedPointersContainerType::iterator i_pointer = mLoadedPointers.find(p_pointer);
-            if(i_pointer == mLoadedPointers.end())
+            void** pp_loaded_pointer = mLoadedPointers.find(p_pointer);
+            if(pp_loaded_pointer == nullptr)
             {
                 if(pointer_type == SP_BASE_CLASS_POINTER)
                 {
@@ -219,12 +227,12 @@ public:
                 }
 
                 // Load the pointer address before loading the content
-                mLoadedPointers[p_pointer]=&pValue;
+                mLoadedPointers.insert(p_pointer, &pValue);
                 load(rTag, *pValue);
             }
             else
             {
-                pValue = *static_cast<std::shared_ptr<TDataType>*>((i_pointer->second));
+                pValue = *static_cast<std::shared_ptr<TDataType>*>((*pp_loaded_pointer));
             }
         }
     }
@@ -239,8 +247,8 @@ public:
         if(pointer_type != SP_INVALID_POINTER)
         {
             read(p_pointer);
-            LoadedPointersContainerType::iterator i_pointer = mLoadedPointers.find(p_pointer);
-            if(i_pointer == mLoadedPointers.end())
+            void** pp_loaded_pointer = mLoadedPointers.find(p_pointer);
+            if(pp_loaded_pointer == nullptr)
             {
                 if(pointer_type == SP_BASE_CLASS_POINTER)
                 {
@@ -264,12 +272,12 @@ public:
                 }
 
                 // Load the pointer address before loading the content
-                mLoadedPointers[p_pointer]=&pValue;
+                mLoadedPointers.insert(p_pointer, &pValue);
                 load(rTag, *pValue);
             }
             else
             {
-                pValue = *static_cast<CoSimIO::intrusive_ptr<TDataType>*>((i_pointer->second));
+                pValue = *static_cast<CoSimIO::intrusive_ptr<TDataType>*>((*pp_loaded_pointer));
             }
         }
     }
@@ -284,8 +292,8 @@ public:
         if(pointer_type != SP_INVALID_POINTER)
         {
             read(p_pointer);
-            LoadedPointersContainerType::iterator i_pointer = mLoadedPointers.find(p_pointer);
-            if(i_pointer == mLoadedPointers.end())
+            void** pp_loaded_pointer = mLoadedPointers.find(p_pointer);
+            if(pp_loaded_pointer == nullptr)
             {
                 if(pointer_type == SP_BASE_CLASS_POINTER)
                 {
@@ -309,12 +317,12 @@ public:
                 }
 
                 // Load the pointer address before loading the content
-                mLoadedPointers[p_pointer]=pValue.get();
+                mLoadedPointers.insert(p_pointer, pValue.get());
                 load(rTag, *pValue);
             }
             else
             {
-                pValue = std::move(std::unique_ptr<TDataType>(static_cast<TDataType*>((i_pointer->second))));
+                pValue = std::move(std::unique_ptr<TDataType>(static_cast<TDataType*>((*pp_loaded_pointer))));
             }
         }
     }
@@ -329,8 +337,8 @@ public:
         if(pointer_type != SP_INVALID_POINTER)
         {
             read(p_pointer);
-            LoadedPointersContainerType::iterator i_pointer = mLoadedPointers.find(p_pointer);
-            if(i_pointer == mLoadedPointers.end())
+            void** pp_loaded_pointer = mLoadedPointers.find(p_pointer);
+            if(pp_loaded_pointer == nullptr)
             {
                 if(pointer_type == SP_BASE_CLASS_POINTER)
                 {
@@ -355,12 +363,12 @@ public:
                 }
 
                 // Load the pointer address before loading the content
-                mLoadedPointers[p_pointer]=&pValue;
+                mLoadedPointers.insert(p_pointer, &pValue);
                 load(rTag, *pValue);
             }
             else
             {
-                pValue = *static_cast<TDataType**>((i_pointer->second));
+                pValue = *static_cast<TDataType**>((*pp_loaded_pointer));
             }
         }
     }
@@ -383,8 +391,7 @@ public:
 
         rObject.resize(size);
 
-        for (SizeType i = 0 ; i < size ; i++)
-            load("E", rObject[i]);
+        load_vector_values(rObject, IsContiguouslySerializable<TDataType>());
     }
 
     template<class TKeyType, class TDataType>
@@ -441,8 +448,7 @@ public:
 
         save("size", size);
 
-        for (SizeType i = 0 ; i < size ; i++)
-            save("E", rObject[i]);
+        save_vector_values(rObject, IsContiguouslySerializable<TDataType>());
     }
 
     template<class TKeyType, class TDataType>
@@ -581,6 +587,28 @@ public:
         rObject.TDataType::save(*this);
     }
 
+    /// Saves a contiguous block of values with a single trace point
+    /// In binary mode the block is written at once, the result is the same as writing the values individually
+    template<class TDataType>
+    void save_contiguous(std::string const & rTag, const TDataType* pData, const SizeType Size)
+    {
+        static_assert(std::is_arithmetic<TDataType>::value, "Only arithmetic types can be saved contiguously!");
+
+        save_trace_point(rTag);
+        write(pData, Size);
+    }
+
+    /// Loads a contiguous block of values that was saved with "save_contiguous"
+    /// The memory for the values has to be allocated already
+    template<class TDataType>
+    void load_contiguous(std::string const & rTag, TDataType* pData, const SizeType Size)
+    {
+        static_assert(std::is_arithmetic<TDataType>::value, "Only arithmetic types can be loaded contiguously!");
+
+        load_trace_point(rTag);
+        read(pData, Size);
+    }
+
     void save_trace_point(std::string const & rTag)
     {
         if(mTrace == SERIALIZER_TRACE_ERROR || mTrace == SERIALIZER_TRACE_ALL) {
@@ -674,8 +702,7 @@ private:
     void SavePointer(std::string const & rTag, const TDataType * pValue)
     {
         write(pValue);
-        if (mSavedPointers.find(pValue) == mSavedPointers.end()) {
-            mSavedPointers.insert(pValue);
+        if (mSavedPointers.insert(pValue, true)) {
             if (IsDerived(pValue)) {
                 typename RegisteredObjectsNameContainerType::iterator i_name = msRegisteredObjectsName.find(typeid (*pValue).name());
 
@@ -691,6 +718,53 @@ private:
         }
     }
 
+    // types whose values can be saved as one block of memory
+    // excluding bool as std::vector<bool> does not store its values contiguously
+    template<class TDataType>
+    using IsContiguouslySerializable = std::integral_constant<bool, std::is_arithmetic<TDataType>::value && !std::is_same<TDataType, bool>::value>;
+
+    template<class TDataType>
+    void save_vector_values(std::vector<TDataType> const& rObject, std::true_type)
+    {
+        save_contiguous("values", rObject.data(), rObject.size());
+    }
+
+    // types that are tracked in the saved/loaded pointers
+    template<class TDataType> struct IsPointer : std::false_type {};
+    template<class TDataType> struct IsPointer<TDataType*> : std::true_type {};
+    template<class TDataType> struct IsPointer<std::shared_ptr<TDataType>> : std::true_type {};
+    template<class TDataType> struct IsPointer<std::unique_ptr<TDataType>> : std::true_type {};
+    template<class TDataType> struct IsPointer<CoSimIO::intrusive_ptr<TDataType>> : std::true_type {};
+
+    template<class TDataType>
+    void save_vector_values(std::vector<TDataType> const& rObject, std::false_type)
+    {
+        // avoid rehashing while saving many pointers, e.g. the nodes of a ModelPart
+        if (IsPointer<TDataType>::value) {
+            mSavedPointers.reserve(mSavedPointers.size() + rObject.size());
+        }
+
+        for (SizeType i = 0 ; i < rObject.size() ; i++)
+            save("E", rObject[i]);
+    }
+
+    template<class TDataType>
+    void load_vector_values(std::vector<TDataType>& rObject, std::true_type)
+    {
+        load_contiguous("values", rObject.data(), rObject.size());
+    }
+
+    template<class TDataType>
+    void load_vector_values(std::vector<TDataType>& rObject, std::false_type)
+    {
+        if (IsPointer<TDataType>::value) {
+            mLoadedPointers.reserve(mLoadedPointers.size() + rObject.size());
+        }
+
+        for (SizeType i = 0 ; i < rObject.size() ; i++)
+            load("E", rObject[i]);
+    }
+
     template<class TMapType>
     void load_map(std::string const & rTag, TMapType& rObject)
     {
@@ -829,25 +903,21 @@ private:
     template<class TDataType>
     void read(std::vector<TDataType>& rData)
     {
-        CO_SIM_IO_SERIALIZER_MODE_BINARY
-
         SizeType size;
-        mpBuffer->read((char *)(&size),sizeof(SizeType));
 
-        rData.resize(size);
+        CO_SIM_IO_SERIALIZER_MODE_BINARY
 
-        read(rData.begin(), rData.end(), sizeof(TDataType));
+        mpBuffer->read((char *)(&size),sizeof(SizeType));
 
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
-        std::size_t size;
         *mpBuffer >> size;
-        rData.resize(size);
         mNumberOfLines++;
 
-        read(rData.begin(), rData.end());
-
         CO_SIM_IO_SERIALIZER_MODE_END
+
+        rData.resize(size);
+        read(rData.data(), size);
     }
 
     template<class TDataType>
@@ -860,49 +930,49 @@ private:
         const char * data = reinterpret_cast<const char *>(&rData_size);
         mpBuffer->write(data,sizeof(SizeType));
 
-        write(rData.begin(), rData.end(), sizeof(TDataType));
-
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
         *mpBuffer << rData.size() << std::endl;
-        write(rData.begin(), rData.end());
 
         CO_SIM_IO_SERIALIZER_MODE_END
+
+        write(rData.data(), rData.size());
     }
 
-    template<class TIteratorType>
-    void read(TIteratorType First, TIteratorType Last, SizeType size)
+    // reads "Size" values that are stored contiguously, in binary mode with a single read
+    template<class TDataType>
+    void read(TDataType* pData, const SizeType Size)
     {
         CO_SIM_IO_SERIALIZER_MODE_BINARY
 
-        for (; First != Last ; First++) {
-            mpBuffer->read((char *)First,sizeof(size));
+        if (Size > 0) {
+            mpBuffer->read(reinterpret_cast<char *>(pData), Size*sizeof(TDataType));
         }
 
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
-        for (; First != Last ; First++) {
-            *mpBuffer >> *First;
+        for (SizeType i = 0; i < Size; ++i) {
+            *mpBuffer >> pData[i];
             mNumberOfLines++;
         }
 
         CO_SIM_IO_SERIALIZER_MODE_END
     }
 
-    template<class TIteratorType>
-    void write(TIteratorType First, TIteratorType Last, SizeType size)
+    // writes "Size" values that are stored contiguously, in binary mode with a single write
+    template<class TDataType>
+    void write(const TDataType* pData, const SizeType Size)
     {
         CO_SIM_IO_SERIALIZER_MODE_BINARY
 
-        for (; First != Last ; First++) {
-            const char * data = reinterpret_cast<const char *>(First);
-            mpBuffer->write(data,sizeof(size));
+        if (Size > 0) {
+            mpBuffer->write(reinterpret_cast<const char *>(pData), Size*sizeof(TDataType));
         }
 
         CO_SIM_IO_SERIALIZER_MODE_ASCII
 
-        for (; First != Last ; First++) {
-            *mpBuffer << *First << std::endl;
+        for (SizeType i = 0; i < Size; ++i) {
+            *mpBuffer << pData[i] << std::endl;
         }
 
         CO_SIM_IO_SERIALIZER_MODE_END
@@ -23,23 +23,40 @@ namespace CoSimIO {
 namespace Internals {
 
 // This class provides a simpler interface for serialization to a string instead of to a file
+// The data is written directly into a contiguous buffer and read directly from the given data,
+// hence no copies are made as it would be the case with a std::stringstream
 // Note that you may not override any load or save method of the Serializer. They are not virtual.
 class CO_SIM_IO_API StreamSerializer : public Serializer
 {
   public:
-    ///this constructor simply wraps the standard Serializer and defines output to basic_iostream
+    ///this constructor simply wraps the standard Serializer and defines output to a growable buffer
     ///@param rTrace type of serialization to be employed
     explicit StreamSerializer(TraceType const& rTrace=SERIALIZER_NO_TRACE);
 
-    //this constructor generates a standard Serializer AND fills the buffer with the data contained in "data"
+    //this constructor generates a standard Serializer that reads from the data contained in "data"
+    //the data is NOT copied, hence it has to stay alive as long as the serializer is used
     ///@param rData a string contained the data to be used in filling the buffer
     ///@param rTrace type of serialization to be employed
     StreamSerializer(const std::string& rData, TraceType const& rTrace=SERIALIZER_NO_TRACE);
 
+    //this constructor generates a standard Serializer that takes over the data contained in "data"
+    ///@param rData a string contained the data to be used in filling the buffer
+    ///@param rTrace type of serialization to be employed
+    StreamSerializer(std::string&& rData, TraceType const& rTrace=SERIALIZER_NO_TRACE);
+
+    //this constructor generates a standard Serializer that reads from the given memory
+    //the data is NOT copied, hence it has to stay alive as long as the serializer is used
+    ///@param pData pointer to the data to be used in filling the buffer
+    ///@param Size size of the data in bytes
+    ///@param rTrace type of serialization to be employed
+    StreamSerializer(const char* pData, const std::size_t Size, TraceType const& rTrace=SERIALIZER_NO_TRACE);
+
     //get a string representation of the serialized data
-    std::string GetStringRepresentation() {
-        return ((std::stringstream*)(this->pGetBuffer()))->str();
-    }
+    //the reference is invalidated when serializing more data
+    const std::string& GetStringRepresentation();
+
+    //move the serialized data out of the serializer, afterwards the serializer is empty
+    std::string ExtractStringRepresentation();
 
     /// Assignment operator.
     StreamSerializer& operator=(StreamSerializer const& rOther) = delete;
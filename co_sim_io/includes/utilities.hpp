@@ -17,6 +17,8 @@
 #include <string>
 #include <chrono>
 #include <set>
+#include <thread>
+#include <algorithm>
 
 // Project includes
 #include "define.hpp"
@@ -49,7 +51,45 @@ int CO_SIM_IO_API GetNumberOfNodesForElementType(const ElementType I_ElementType
 
 std::string CO_SIM_IO_API GetElementName(const ElementType I_ElementType);
 
-void CO_SIM_IO_API WaitUntilPathExists(const fs::path& rPath);
+// how to wait for paths in the filesystem to appear or to be removed
+// Polling: checking continuously with short breaks, fastest reaction but puts a lot of load on the filesystem
+// Backoff: the time between the checks is increased the longer the waiting takes
+// Inotify: waiting for events of the filesystem (Linux only), combined with
+//          checks with backoff as filesystems that are shared across compute nodes don't issue events for changes made on other nodes
+enum class FileWaitStrategy {Polling, Backoff, Inotify};
+
+std::string CO_SIM_IO_API FileWaitStrategyToString(const FileWaitStrategy Strategy);
+
+FileWaitStrategy CO_SIM_IO_API StringToFileWaitStrategy(const std::string& rStrategy);
+
+void CO_SIM_IO_API WaitUntilPathExists(
+    const fs::path& rPath,
+    const FileWaitStrategy Strategy=FileWaitStrategy::Polling);
+
+void CO_SIM_IO_API WaitUntilPathIsRemoved(
+    const fs::path& rPath,
+    const FileWaitStrategy Strategy=FileWaitStrategy::Polling);
+
+// waits until the condition is fulfilled
+// first busy-waiting (lowest latency), then yielding and finally
+// sleeping with increasing durations to not block a core when waiting long
+template<class TConditionType>
+void WaitUntil(TConditionType&& rCondition)
+{
+    std::size_t counter = 0;
+    int sleep_time_us = 1;
+    while (!rCondition()) {
+        if (counter < 1000) {
+            ++counter;
+        } else if (counter < 2000) {
+            ++counter;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(sleep_time_us));
+            sleep_time_us = std::min(2*sleep_time_us, 100);
+        }
+    }
+}
 
 std::set<std::size_t> CO_SIM_IO_API ComputePartnerRanksAsImporter(
     const std::size_t MyRank,
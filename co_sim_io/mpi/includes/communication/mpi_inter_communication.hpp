@@ -14,6 +14,14 @@
 #define CO_SIM_IO_MPI_INTER_COMMUNICATION_INCLUDED
 
 // System includes
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 // External includes
 #include "mpi.h"
@@ -58,11 +66,136 @@ public:
         Internals::DataContainer<double>& rData) override;
 
 private:
+    class ImportRequest;
+    class ExportRequest;
+
     MPI_Comm mInterComm;
     std::string mPortName;
 
+    // each identifier is sent with its own tag, such that exchanges of different identifiers can be completed in any order
+    // the tags are derived from a hash of the identifier, the registry detects when two identifiers are mapped to the same tag
+    int mMaxTag = 0; // smaller one of MPI_TAG_UB of both partners
+    std::map<std::string, int> mIdentifierTags;
+    std::map<int, std::string> mTagIdentifiers;
+
+    int GetTag(const Info& I_Info);
+
+    using IdentifierAndRankType = std::pair<std::string, int>; // identifier and partner rank
+
+    // persistent requests of DataContainers, which are reused as long as the size and the memory location of the data don't change
+    // the exporting rank announces if the data gets larger than the posted receive of the partner, the partner then probes the new size
+    struct PersistentSend
+    {
+        MPI_Request Request = MPI_REQUEST_NULL;
+        const double* pData = nullptr;
+        std::size_t Size = 0;
+        std::size_t PartnerCapacity = 0;
+    };
+
+    struct PersistentReceive
+    {
+        MPI_Request Request = MPI_REQUEST_NULL;
+        double* pData = nullptr;
+        std::size_t Capacity = 0;
+    };
+
+    bool mUsePersistentRequests = false;
+    std::map<IdentifierAndRankType, PersistentSend> mPersistentSends;
+    std::map<IdentifierAndRankType, PersistentReceive> mPersistentReceives;
+
+    double SendDataContainerPersistent(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData);
+
+    double ReceiveDataContainerPersistent(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData);
+
+    // one-sided communication (RMA) of DataContainers
+    // the importing ranks attach one buffer per identifier and partner rank to a dynamic window, into which the exporting rank puts the data
+    // the buffers are created on first use and only reattached if the data gets larger (then the data is sent with two-sided communication)
+    enum class RMAMessageType : std::uint64_t {Size, Released};
+
+    struct RMAImportBuffer
+    {
+        std::vector<double> Data;
+        std::array<std::uint64_t, 3> ReleaseMessage;
+        MPI_Request ReleaseRequest = MPI_REQUEST_NULL;
+    };
+
+    struct RMAExportTarget
+    {
+        std::uint64_t Address = 0;
+        std::size_t Capacity = 0;
+        bool IsReleased = true;
+    };
+
+
+    bool mUseRMA = false;
+    MPI_Comm mMergedComm = MPI_COMM_NULL;
+    MPI_Win mWindow = MPI_WIN_NULL;
+    std::map<IdentifierAndRankType, RMAImportBuffer> mRMAImportBuffers;
+    std::map<IdentifierAndRankType, RMAExportTarget> mRMAExportTargets;
+
+    // control messages that were received while waiting for another one (partner rank, hash of identifier, type)
+    std::map<std::tuple<int, std::uint64_t, std::uint64_t>, std::deque<std::uint64_t>> mRMAReceivedMessages;
+
+    double SendDataContainerRMA(
+        const Info& I_Info,
+        const Internals::DataContainer<double>& rData);
+
+    double ReceiveDataContainerRMA(
+        const Info& I_Info,
+        Internals::DataContainer<double>& rData);
+
+    void SendRMAMessage(
+        const int PartnerRank,
+        const std::string& rIdentifier,
+        const RMAMessageType Type,
+        const std::uint64_t Value);
+
+    std::uint64_t ReceiveRMAMessage(
+        const int PartnerRank,
+        const std::string& rIdentifier,
+        const RMAMessageType Type);
+
+    // rank in the communicator that contains the ranks of both partners
+    int GetMergedRank(
+        const int Rank,
+        const bool IsPrimary) const;
+
+    // asynchronous imports whose receive is not yet posted, as their size is not yet known
+    std::vector<ImportRequest*> mImportsWithoutReceive;
+
+    void ProgressPendingImports();
+
+    bool IsFirstPendingImportOfTag(const ImportRequest* pRequest) const;
+
+    void WaitWithProgress(MPI_Request& rRequest);
+
+    void Send(
+        const void* pData,
+        const std::size_t Size,
+        MPI_Datatype DataType,
+        const int PartnerRank,
+        const int Tag);
+
     void PrepareConnection(const Info& I_Info) override;
 
+    // the ranks of the partner are addressed directly through the intercommunicator
+    bool SupportsDifferentNumberOfProcesses() const override {return true;}
+
+    // non-blocking MPI is used instead of background threads
+    std::unique_ptr<AsyncRequest> ImportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<Internals::DataContainer<double>> pData) override;
+
+    std::unique_ptr<AsyncRequest> ExportDataAsyncImpl(
+        const Info& I_Info,
+        std::shared_ptr<const Internals::DataContainer<double>> pData) override;
+
+    void DerivedHandShake() const override;
+
     Info GetCommunicationSettings() const override;
 };
 
@@ -11,10 +11,14 @@
 //
 
 // System includes
+#include <chrono>
+#include <algorithm>
+#include <set>
 
 // Project includes
 #include "mpi/includes/communication/mpi_inter_communication.hpp"
 #include "mpi/includes/mpi_data_communicator.hpp"
+#include "includes/stream_serializer.hpp"
 
 namespace CoSimIO {
 namespace Internals {
@@ -23,27 +27,267 @@ namespace Internals {
 
 namespace {
 
+// messages without identifier are sent with tag 0, the control messages of the one-sided communication with tag 1
+// the messages of an identifier are sent with a tag that is derived from it (see GetTag)
+constexpr int RMA_MESSAGE_TAG = 1;
+constexpr int FIRST_IDENTIFIER_TAG = 2;
+
+// stable hash (FNV-1a), such that both partners compute the same value for an identifier
+std::uint64_t HashIdentifier(const std::string& rIdentifier)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : rIdentifier) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 template<typename TMPIDataType>
 int ReceiveSize(
     MPI_Comm Comm,
     TMPIDataType DataType,
-    const int Rank)
+    const int Rank,
+    const int Tag)
 {
+    WaitTimer wait_timer; // blocks until the partner sends
     int size;
     MPI_Status status;
-    MPI_Probe(Rank, 0, Comm, &status);
+    MPI_Probe(Rank, Tag, Comm, &status);
     MPI_Get_count(&status, DataType, &size);
     return size;
 }
 
+int GetMaxTag()
+{
+    int* p_max_tag;
+    int flag;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &p_max_tag, &flag); // todo check return code
+    CO_SIM_IO_ERROR_IF_NOT(flag) << "MPI_TAG_UB is not available!" << std::endl;
+    return *p_max_tag;
+}
+
 }
 
+// export that is completed by MPI_Test/MPI_Wait
+class MPIInterCommunication::ExportRequest : public AsyncRequest
+{
+public:
+    ExportRequest(
+        MPIInterCommunication& rComm,
+        std::shared_ptr<const DataContainer<double>> pData,
+        const int PartnerRank,
+        const int Tag)
+        : mrComm(rComm),
+          mpData(pData),
+          mStartTime(std::chrono::steady_clock::now())
+    {
+        if (mrComm.GetAlwaysUseSerializer()) {
+            StreamSerializer serializer(mrComm.GetSerializerTraceType());
+            serializer.save("object", *pData);
+            mBuffer = serializer.ExtractStringRepresentation();
+            mMemoryUsage = mBuffer.size();
+            MPI_Isend(mBuffer.data(), mBuffer.size(), MPI_CHAR, PartnerRank, Tag, mrComm.mInterComm, &mRequest); // todo check return code
+        } else {
+            mMemoryUsage = pData->size()*sizeof(double);
+            MPI_Isend(pData->data(), pData->size(), MPI_DOUBLE, PartnerRank, Tag, mrComm.mInterComm, &mRequest); // todo check return code
+        }
+    }
+
+    bool Test() override
+    {
+        if (!mIsCompleted) {
+            mrComm.ProgressPendingImports();
+            int flag;
+            MPI_Test(&mRequest, &flag, MPI_STATUS_IGNORE); // todo check return code
+            if (flag) {Complete();}
+        }
+        return mIsCompleted;
+    }
+
+    void WaitForCompletion() override
+    {
+        if (!mIsCompleted) {
+            mrComm.WaitWithProgress(mRequest);
+            Complete();
+        }
+    }
+
+    Info GetInfo() override
+    {
+        WaitForCompletion();
+
+        Info info;
+        info.Set<double>("elapsed_time", mElapsedTime);
+        info.Set<std::size_t>("memory_usage_ipc", mMemoryUsage);
+        return info;
+    }
+
+private:
+    MPIInterCommunication& mrComm;
+    std::shared_ptr<const DataContainer<double>> mpData;
+    std::string mBuffer;
+    MPI_Request mRequest;
+    bool mIsCompleted = false;
+    std::chrono::steady_clock::time_point mStartTime;
+    double mElapsedTime = 0.0;
+    std::size_t mMemoryUsage = 0;
+
+    void Complete()
+    {
+        mIsCompleted = true;
+        mElapsedTime = Utilities::ElapsedSeconds(mStartTime);
+        mBuffer = std::string(); // free memory
+    }
+};
+
+// import that is completed by MPI_Test/MPI_Wait
+// the size of the message is unknown when the request is started, hence the receive is posted
+// once the message is available (MPI_Iprobe), such that the container can be resized accordingly
+class MPIInterCommunication::ImportRequest : public AsyncRequest
+{
+public:
+    ImportRequest(
+        MPIInterCommunication& rComm,
+        std::shared_ptr<DataContainer<double>> pData,
+        const int Tag)
+        : mrComm(rComm),
+          mpData(pData),
+          mTag(Tag),
+          mStartTime(std::chrono::steady_clock::now())
+    {
+        mrComm.mImportsWithoutReceive.push_back(this);
+    }
+
+    ~ImportRequest() override
+    {
+        RemoveFromComm();
+    }
+
+    bool Test() override
+    {
+        if (!mIsReceivePosted) {
+            mrComm.ProgressPendingImports();
+            if (!mIsReceivePosted) {return false;}
+        }
+
+        if (!mIsCompleted) {
+            int flag;
+            MPI_Test(&mRequest, &flag, MPI_STATUS_IGNORE); // todo check return code
+            if (flag) {Complete();}
+        }
+
+        return mIsCompleted;
+    }
+
+    void WaitForCompletion() override
+    {
+        if (!mIsReceivePosted) {
+            CO_SIM_IO_ERROR_IF_NOT(mrComm.IsFirstPendingImportOfTag(this)) << "The previous imports of this identifier have to be completed first!" << std::endl;
+            MPI_Status status;
+            MPI_Probe(mrComm.GetDataCommunicator().Rank(), mTag, mrComm.mInterComm, &status); // todo check return code
+            PostReceive(status);
+        }
+
+        if (!mIsCompleted) {
+            MPI_Wait(&mRequest, MPI_STATUS_IGNORE); // todo check return code
+            Complete();
+        }
+    }
+
+    Info GetInfo() override
+    {
+        CO_SIM_IO_TRY
+
+        WaitForCompletion();
+
+        Info info;
+
+        if (mrComm.GetAlwaysUseSerializer()) {
+            const auto start_time(std::chrono::steady_clock::now());
+            StreamSerializer serializer(mBuffer, mrComm.GetSerializerTraceType());
+            serializer.load("object", *mpData);
+            const double elapsed_time_load = Utilities::ElapsedSeconds(start_time);
+            mBuffer = std::string(); // free memory
+
+            info.Set<double>("elapsed_time_ipc", mElapsedTime);
+            info.Set<double>("elapsed_time_serializer", elapsed_time_load);
+            mElapsedTime += elapsed_time_load;
+        }
+
+        info.Set<double>("elapsed_time", mElapsedTime);
+        info.Set<std::size_t>("memory_usage_ipc", mMemoryUsage);
+        return info;
+
+        CO_SIM_IO_CATCH
+    }
+
+    bool IsReceivePosted() const {return mIsReceivePosted;}
+
+    int GetTag() const {return mTag;}
+
+    // posts the receive if the message is available
+    void TryPostReceive()
+    {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(mrComm.GetDataCommunicator().Rank(), mTag, mrComm.mInterComm, &flag, &status); // todo check return code
+        if (flag) {PostReceive(status);}
+    }
+
+private:
+    MPIInterCommunication& mrComm;
+    std::shared_ptr<DataContainer<double>> mpData;
+    std::string mBuffer;
+    int mTag;
+    MPI_Request mRequest;
+    bool mIsReceivePosted = false;
+    bool mIsCompleted = false;
+    std::chrono::steady_clock::time_point mStartTime;
+    double mElapsedTime = 0.0;
+    std::size_t mMemoryUsage = 0;
+
+    void PostReceive(MPI_Status& rStatus)
+    {
+        const int rank = mrComm.GetDataCommunicator().Rank();
+        int size;
+        if (mrComm.GetAlwaysUseSerializer()) {
+            MPI_Get_count(&rStatus, MPI_CHAR, &size);
+            mBuffer.resize(size);
+            mMemoryUsage = size;
+            MPI_Irecv(&mBuffer[0], size, MPI_CHAR, rank, mTag, mrComm.mInterComm, &mRequest); // todo check return code
+        } else {
+            MPI_Get_count(&rStatus, MPI_DOUBLE, &size);
+            mpData->resize(size);
+            mMemoryUsage = size*sizeof(double);
+            MPI_Irecv(mpData->data(), size, MPI_DOUBLE, rank, mTag, mrComm.mInterComm, &mRequest); // todo check return code
+        }
+        mIsReceivePosted = true;
+        RemoveFromComm();
+    }
+
+    void Complete()
+    {
+        mIsCompleted = true;
+        mElapsedTime = Utilities::ElapsedSeconds(mStartTime);
+    }
+
+    void RemoveFromComm()
+    {
+        auto& r_imports = mrComm.mImportsWithoutReceive;
+        r_imports.erase(std::remove(r_imports.begin(), r_imports.end(), this), r_imports.end());
+    }
+};
+
 MPIInterCommunication::MPIInterCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
-    : Communication(I_Settings, I_DataComm)
+    : Communication(I_Settings, I_DataComm),
+      mUsePersistentRequests(I_Settings.Get<bool>("use_persistent_requests", false)),
+      mUseRMA(I_Settings.Get<bool>("use_rma", false))
 {
     CO_SIM_IO_ERROR_IF_NOT(I_DataComm->IsDistributed()) << "MPI communication only works with a MPIDataCommunicator!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUsePersistentRequests && mUseRMA) << "\"use_persistent_requests\" and \"use_rma\" cannot be combined!" << std::endl;
 }
 
 MPIInterCommunication::~MPIInterCommunication()
@@ -73,6 +317,14 @@ Info MPIInterCommunication::ConnectDetail(const Info& I_Info)
         MPI_Comm_connect(mPortName.c_str(), MPI_INFO_NULL, 0, my_comm, &mInterComm); // todo check return code
     }
 
+    mMaxTag = std::min(GetMaxTag(), GetPartnerInfo().Get<Info>("communication_settings").Get<int>("max_tag"));
+
+    if (mUseRMA) {
+        // windows cannot be created on an intercommunicator, hence the groups are merged (the ranks of the primary come first)
+        MPI_Intercomm_merge(mInterComm, GetIsPrimaryConnection() ? 0 : 1, &mMergedComm); // todo check return code
+        MPI_Win_create_dynamic(MPI_INFO_NULL, mMergedComm, &mWindow); // todo check return code
+    }
+
     return Info(); // TODO use
 
     CO_SIM_IO_CATCH
@@ -82,6 +334,42 @@ Info MPIInterCommunication::DisconnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    for (auto& r_send : mPersistentSends) {
+        MPI_Request_free(&r_send.second.Request); // todo check return code
+    }
+    for (auto& r_receive : mPersistentReceives) {
+        MPI_Request_free(&r_receive.second.Request); // todo check return code
+    }
+    mPersistentSends.clear();
+    mPersistentReceives.clear();
+
+    mIdentifierTags.clear();
+    mTagIdentifiers.clear();
+
+    if (mUseRMA) {
+        // the buffers of the last exports have to be released by the partner before the window can be freed
+        for (auto& r_target : mRMAExportTargets) {
+            if (!r_target.second.IsReleased) {
+                ReceiveRMAMessage(r_target.first.second, r_target.first.first, RMAMessageType::Released);
+                r_target.second.IsReleased = true;
+            }
+        }
+
+        for (auto& r_buffer : mRMAImportBuffers) {
+            MPI_Wait(&r_buffer.second.ReleaseRequest, MPI_STATUS_IGNORE); // todo check return code
+            if (!r_buffer.second.Data.empty()) {
+                MPI_Win_detach(mWindow, r_buffer.second.Data.data()); // todo check return code
+            }
+        }
+
+        MPI_Win_free(&mWindow); // todo check return code
+        MPI_Comm_free(&mMergedComm); // todo check return code
+
+        mRMAImportBuffers.clear();
+        mRMAExportTargets.clear();
+        mRMAReceivedMessages.clear();
+    }
+
     MPI_Comm_disconnect(&mInterComm); // todo check return code
 
     if (GetIsPrimaryConnection() && GetDataCommunicator().Rank()==0) {
@@ -118,6 +406,10 @@ Info MPIInterCommunication::GetCommunicationSettings() const
 
     Info info;
 
+    info.Set("max_tag", GetMaxTag());
+    info.Set("use_persistent_requests", mUsePersistentRequests);
+    info.Set("use_rma", mUseRMA);
+
     if (GetIsPrimaryConnection() && GetDataCommunicator().Rank() == 0) {
         info.Set("port_name", mPortName);
     }
@@ -127,6 +419,145 @@ Info MPIInterCommunication::GetCommunicationSettings() const
     CO_SIM_IO_CATCH
 }
 
+void MPIInterCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_TRY
+
+    for (const std::string& r_setting : std::vector<std::string>{"use_persistent_requests", "use_rma"}) {
+        const bool my_value = GetMyInfo().Get<Info>("communication_settings").Get<bool>(r_setting);
+        const bool partner_value = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>(r_setting);
+        CO_SIM_IO_ERROR_IF(my_value != partner_value) << std::boolalpha << "Mismatch in " << r_setting << "!\nMy " << r_setting << ": " << my_value << "\nPartner " << r_setting << ": " << partner_value << std::noboolalpha << std::endl;
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+std::unique_ptr<AsyncRequest> MPIInterCommunication::ImportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(GetIsMToNConnection()) << "Asynchronous imports are not supported if the partner runs with a different number of processes!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUseRMA) << "Asynchronous imports are not supported with \"use_rma\"!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUsePersistentRequests) << "Asynchronous imports are not supported with \"use_persistent_requests\"!" << std::endl;
+
+    std::unique_ptr<AsyncRequest> p_request = CoSimIO::make_unique<ImportRequest>(*this, pData, GetTag(I_Info));
+    p_request->Test(); // post the receive right away if the message is already available
+    return p_request;
+
+    CO_SIM_IO_CATCH
+}
+
+std::unique_ptr<AsyncRequest> MPIInterCommunication::ExportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(mUseRMA) << "Asynchronous exports are not supported with \"use_rma\"!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUsePersistentRequests) << "Asynchronous exports are not supported with \"use_persistent_requests\"!" << std::endl;
+
+    return CoSimIO::make_unique<ExportRequest>(*this, pData, GetPartnerRank(I_Info), GetTag(I_Info));
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIInterCommunication::ProgressPendingImports()
+{
+    CO_SIM_IO_TRY
+
+    // the messages of an identifier are matched in order, hence its receives are posted in the order in which the imports were started
+    // imports of other identifiers are not held back
+    const std::vector<ImportRequest*> pending_imports(mImportsWithoutReceive); // the imports remove themselves once the receive is posted
+    std::set<int> waiting_tags;
+    for (ImportRequest* p_request : pending_imports) {
+        if (waiting_tags.count(p_request->GetTag()) > 0) {continue;}
+        p_request->TryPostReceive();
+        if (!p_request->IsReceivePosted()) {waiting_tags.insert(p_request->GetTag());}
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+bool MPIInterCommunication::IsFirstPendingImportOfTag(const ImportRequest* pRequest) const
+{
+    for (const ImportRequest* p_request : mImportsWithoutReceive) {
+        if (p_request->GetTag() == pRequest->GetTag()) {
+            return p_request == pRequest;
+        }
+    }
+    return false;
+}
+
+int MPIInterCommunication::GetTag(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (!I_Info.Has("identifier")) {
+        return 0;
+    }
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+
+    const auto it_tag = mIdentifierTags.find(identifier);
+    if (it_tag != mIdentifierTags.end()) {
+        return it_tag->second;
+    }
+
+    // both partners derive the same tag from the identifier, hence no communication is needed
+    const std::uint64_t num_identifier_tags = static_cast<std::uint64_t>(mMaxTag - FIRST_IDENTIFIER_TAG) + 1;
+    const int tag = FIRST_IDENTIFIER_TAG + static_cast<int>(HashIdentifier(identifier) % num_identifier_tags);
+
+    const auto it_identifier = mTagIdentifiers.find(tag);
+    CO_SIM_IO_ERROR_IF(it_identifier != mTagIdentifiers.end()) << "The identifiers \"" << identifier << "\" and \"" << it_identifier->second << "\" are mapped to the same MPI tag (" << tag << "), please rename one of them!" << std::endl;
+
+    mIdentifierTags[identifier] = tag;
+    mTagIdentifiers[tag] = identifier;
+
+    return tag;
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIInterCommunication::WaitWithProgress(MPI_Request& rRequest)
+{
+    CO_SIM_IO_TRY
+
+    // the partner might wait for an import of this side, whose receive is only posted once its size is known
+    // hence the pending imports have to be progressed, otherwise both sides could block each other
+    while (!mImportsWithoutReceive.empty()) {
+        int flag;
+        MPI_Test(&rRequest, &flag, MPI_STATUS_IGNORE); // todo check return code
+        if (flag) {return;}
+        ProgressPendingImports();
+    }
+
+    MPI_Wait(&rRequest, MPI_STATUS_IGNORE); // todo check return code
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIInterCommunication::Send(
+    const void* pData,
+    const std::size_t Size,
+    MPI_Datatype DataType,
+    const int PartnerRank,
+    const int Tag)
+{
+    CO_SIM_IO_TRY
+
+    if (mImportsWithoutReceive.empty()) {
+        MPI_Send(pData, Size, DataType, PartnerRank, Tag, mInterComm); // todo check return code
+    } else {
+        MPI_Request request;
+        MPI_Isend(pData, Size, DataType, PartnerRank, Tag, mInterComm, &request); // todo check return code
+        WaitWithProgress(request);
+    }
+
+    CO_SIM_IO_CATCH
+}
+
 double MPIInterCommunication::SendString(
     const Info& I_Info,
     const std::string& rData)
@@ -135,13 +566,7 @@ double MPIInterCommunication::SendString(
 
     const auto start_time(std::chrono::steady_clock::now());
 
-    MPI_Send(
-        rData.data(),
-        rData.size(),
-        MPI_CHAR,
-        GetDataCommunicator().Rank(),
-        0,
-        mInterComm); // todo check return code
+    Send(rData.data(), rData.size(), MPI_CHAR, GetPartnerRank(I_Info), GetTag(I_Info));
 
     return Utilities::ElapsedSeconds(start_time);
 
@@ -154,7 +579,9 @@ double MPIInterCommunication::ReceiveString(
 {
     CO_SIM_IO_TRY
 
-    const int size = ReceiveSize(mInterComm, MPI_CHAR, GetDataCommunicator().Rank()); // serves also as synchronization for time measurement
+    const int partner_rank = GetPartnerRank(I_Info);
+    const int tag = GetTag(I_Info);
+    const int size = ReceiveSize(mInterComm, MPI_CHAR, partner_rank, tag); // serves also as synchronization for time measurement
     rData.resize(size);
 
     const auto start_time(std::chrono::steady_clock::now());
@@ -163,8 +590,8 @@ double MPIInterCommunication::ReceiveString(
         &(rData.front()),
         rData.size(),
         MPI_CHAR,
-        GetDataCommunicator().Rank(),
-        0,
+        partner_rank,
+        tag,
         mInterComm,
         MPI_STATUS_IGNORE); // todo check return code
 
@@ -179,15 +606,17 @@ double MPIInterCommunication::SendDataContainer(
 {
     CO_SIM_IO_TRY
 
+    if (mUseRMA) {
+        return SendDataContainerRMA(I_Info, rData);
+    }
+
+    if (mUsePersistentRequests) {
+        return SendDataContainerPersistent(I_Info, rData);
+    }
+
     const auto start_time(std::chrono::steady_clock::now());
 
-    MPI_Send(
-        rData.data(),
-        rData.size(),
-        MPI_DOUBLE,
-        GetDataCommunicator().Rank(),
-        0,
-        mInterComm); // todo check return code
+    Send(rData.data(), rData.size(), MPI_DOUBLE, GetPartnerRank(I_Info), GetTag(I_Info));
 
     return Utilities::ElapsedSeconds(start_time);
 
@@ -200,7 +629,17 @@ double MPIInterCommunication::ReceiveDataContainer(
 {
     CO_SIM_IO_TRY
 
-    const int size = ReceiveSize(mInterComm, MPI_DOUBLE, GetDataCommunicator().Rank()); // serves also as synchronization for time measurement
+    if (mUseRMA) {
+        return ReceiveDataContainerRMA(I_Info, rData);
+    }
+
+    if (mUsePersistentRequests) {
+        return ReceiveDataContainerPersistent(I_Info, rData);
+    }
+
+    const int partner_rank = GetPartnerRank(I_Info);
+    const int tag = GetTag(I_Info);
+    const int size = ReceiveSize(mInterComm, MPI_DOUBLE, partner_rank, tag); // serves also as synchronization for time measurement
     rData.resize(size);
 
     const auto start_time(std::chrono::steady_clock::now());
@@ -209,8 +648,8 @@ double MPIInterCommunication::ReceiveDataContainer(
         rData.data(),
         rData.size(),
         MPI_DOUBLE,
-        GetDataCommunicator().Rank(),
-        0,
+        partner_rank,
+        tag,
         mInterComm,
         MPI_STATUS_IGNORE); // todo check return code
 
@@ -219,6 +658,250 @@ double MPIInterCommunication::ReceiveDataContainer(
     CO_SIM_IO_CATCH
 }
 
+double MPIInterCommunication::SendDataContainerPersistent(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const int partner_rank = GetPartnerRank(I_Info);
+    const int tag = GetTag(I_Info);
+    const std::size_t size = rData.size();
+
+    PersistentSend& r_send = mPersistentSends[IdentifierAndRankType(I_Info.Get<std::string>("identifier"), partner_rank)];
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    if (size > r_send.PartnerCapacity) {
+        // the data does not fit into the posted receive of the partner
+        // the announcement has the same tag as the data, it is recognized by its size (which is not a multiple of the size of a double)
+        const char announcement = 0;
+        MPI_Send(&announcement, 1, MPI_BYTE, partner_rank, tag, mInterComm); // todo check return code
+        r_send.PartnerCapacity = size;
+    }
+
+    if (r_send.Request == MPI_REQUEST_NULL || r_send.pData != rData.data() || r_send.Size != size) {
+        if (r_send.Request != MPI_REQUEST_NULL) {
+            MPI_Request_free(&r_send.Request); // todo check return code
+        }
+        MPI_Send_init(rData.data(), size*sizeof(double), MPI_BYTE, partner_rank, tag, mInterComm, &r_send.Request); // todo check return code
+        r_send.pData = rData.data();
+        r_send.Size = size;
+    }
+
+    MPI_Start(&r_send.Request); // todo check return code
+    MPI_Wait(&r_send.Request, MPI_STATUS_IGNORE); // todo check return code
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIInterCommunication::ReceiveDataContainerPersistent(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const int partner_rank = GetPartnerRank(I_Info);
+    const int tag = GetTag(I_Info);
+
+    PersistentReceive& r_receive = mPersistentReceives[IdentifierAndRankType(I_Info.Get<std::string>("identifier"), partner_rank)];
+
+    // the size is not probed, hence the time includes waiting for the partner (i.e. it is not part of "elapsed_time_wait")
+    // only the probing of the size of larger data is part of it, hence it is excluded here
+    const auto start_time(std::chrono::steady_clock::now());
+    const double wait_time_at_start = WaitTimer::GetAccumulatedTime();
+
+    int num_bytes;
+    while (true) {
+        // one additional double, such that the announcement of larger data fits
+        rData.resize(r_receive.Capacity+1);
+
+        if (r_receive.Request == MPI_REQUEST_NULL || r_receive.pData != rData.data()) {
+            if (r_receive.Request != MPI_REQUEST_NULL) {
+                MPI_Request_free(&r_receive.Request); // todo check return code
+            }
+            MPI_Recv_init(rData.data(), r_receive.Capacity*sizeof(double)+1, MPI_BYTE, partner_rank, tag, mInterComm, &r_receive.Request); // todo check return code
+            r_receive.pData = rData.data();
+        }
+
+        MPI_Status status;
+        MPI_Start(&r_receive.Request); // todo check return code
+        MPI_Wait(&r_receive.Request, &status); // todo check return code
+        MPI_Get_count(&status, MPI_BYTE, &num_bytes); // todo check return code
+
+        if (num_bytes % sizeof(double) == 0) {break;}
+
+        // the data is larger than the posted receive, the size is probed once
+        r_receive.Capacity = ReceiveSize(mInterComm, MPI_BYTE, partner_rank, tag) / sizeof(double);
+        MPI_Request_free(&r_receive.Request); // todo check return code
+    }
+
+    rData.resize(num_bytes / sizeof(double));
+
+    return Utilities::ElapsedSeconds(start_time) - (WaitTimer::GetAccumulatedTime() - wait_time_at_start);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIInterCommunication::SendDataContainerRMA(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    const int partner_rank = GetPartnerRank(I_Info);
+    const std::size_t size = rData.size();
+
+    RMAExportTarget& r_target = mRMAExportTargets[IdentifierAndRankType(identifier, partner_rank)];
+
+    // the partner has to be done with the data of the previous export, it also sends the address of its buffer
+    if (!r_target.IsReleased) {
+        r_target.Address = ReceiveRMAMessage(partner_rank, identifier, RMAMessageType::Released);
+        r_target.IsReleased = true;
+    }
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    if (size > r_target.Capacity) {
+        // the buffer of the partner is too small, hence the data is sent directly
+        // the partner then attaches a larger buffer that is used for the following exports
+        SendRMAMessage(partner_rank, identifier, RMAMessageType::Size, size);
+        MPI_Send(rData.data(), size, MPI_DOUBLE, partner_rank, GetTag(I_Info), mInterComm); // todo check return code
+        r_target.Capacity = size;
+    } else {
+        if (size > 0) {
+            const int target_rank = GetMergedRank(partner_rank, !GetIsPrimaryConnection());
+            MPI_Win_lock(MPI_LOCK_EXCLUSIVE, target_rank, 0, mWindow); // todo check return code
+            MPI_Put(rData.data(), size, MPI_DOUBLE, target_rank, static_cast<MPI_Aint>(r_target.Address), size, MPI_DOUBLE, mWindow); // todo check return code
+            MPI_Win_unlock(target_rank, mWindow); // todo check return code
+        }
+
+        // notifies the partner that the data is available
+        SendRMAMessage(partner_rank, identifier, RMAMessageType::Size, size);
+    }
+
+    r_target.IsReleased = false;
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double MPIInterCommunication::ReceiveDataContainerRMA(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    const int partner_rank = GetPartnerRank(I_Info);
+
+    RMAImportBuffer& r_buffer = mRMAImportBuffers[IdentifierAndRankType(identifier, partner_rank)];
+
+    const std::size_t size = ReceiveRMAMessage(partner_rank, identifier, RMAMessageType::Size); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+
+    if (size > r_buffer.Data.size()) {
+        // the data is sent directly, the received data is kept as the new buffer
+        if (!r_buffer.Data.empty()) {
+            MPI_Win_detach(mWindow, r_buffer.Data.data()); // todo check return code
+        }
+        std::vector<double>(size).swap(r_buffer.Data);
+        MPI_Recv(r_buffer.Data.data(), size, MPI_DOUBLE, partner_rank, GetTag(I_Info), mInterComm, MPI_STATUS_IGNORE); // todo check return code
+        MPI_Win_attach(mWindow, r_buffer.Data.data(), size*sizeof(double)); // todo check return code
+    } else {
+        // making sure that the data put by the partner is visible
+        const int my_rank = GetMergedRank(GetDataCommunicator().Rank(), GetIsPrimaryConnection());
+        MPI_Win_lock(MPI_LOCK_SHARED, my_rank, 0, mWindow); // todo check return code
+        MPI_Win_sync(mWindow); // todo check return code
+        MPI_Win_unlock(my_rank, mWindow); // todo check return code
+    }
+
+    rData.resize(size);
+    if (size > 0) {
+        std::copy(r_buffer.Data.begin(), r_buffer.Data.begin()+size, rData.data());
+    }
+
+    // the partner can put the next data into the buffer, this is not waited for
+    MPI_Aint address = 0;
+    if (!r_buffer.Data.empty()) {
+        MPI_Get_address(r_buffer.Data.data(), &address); // todo check return code
+    }
+    MPI_Wait(&r_buffer.ReleaseRequest, MPI_STATUS_IGNORE); // todo check return code
+    r_buffer.ReleaseMessage = {HashIdentifier(identifier), static_cast<std::uint64_t>(RMAMessageType::Released), static_cast<std::uint64_t>(address)};
+    MPI_Isend(r_buffer.ReleaseMessage.data(), 3, MPI_UINT64_T, partner_rank, RMA_MESSAGE_TAG, mInterComm, &r_buffer.ReleaseRequest); // todo check return code
+
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+void MPIInterCommunication::SendRMAMessage(
+    const int PartnerRank,
+    const std::string& rIdentifier,
+    const RMAMessageType Type,
+    const std::uint64_t Value)
+{
+    CO_SIM_IO_TRY
+
+    const std::array<std::uint64_t, 3> message {HashIdentifier(rIdentifier), static_cast<std::uint64_t>(Type), Value};
+    MPI_Send(message.data(), 3, MPI_UINT64_T, PartnerRank, RMA_MESSAGE_TAG, mInterComm); // todo check return code
+
+    CO_SIM_IO_CATCH
+}
+
+std::uint64_t MPIInterCommunication::ReceiveRMAMessage(
+    const int PartnerRank,
+    const std::string& rIdentifier,
+    const RMAMessageType Type)
+{
+    CO_SIM_IO_TRY
+
+    // the messages of different identifiers can arrive in any order, the ones that are not yet needed are stored
+    const auto key = std::make_tuple(PartnerRank, HashIdentifier(rIdentifier), static_cast<std::uint64_t>(Type));
+
+    auto it_received = mRMAReceivedMessages.find(key);
+    if (it_received != mRMAReceivedMessages.end() && !it_received->second.empty()) {
+        const std::uint64_t value = it_received->second.front();
+        it_received->second.pop_front();
+        return value;
+    }
+
+    WaitTimer wait_timer; // blocks until the partner sends
+    while (true) {
+        std::array<std::uint64_t, 3> message;
+        MPI_Recv(message.data(), 3, MPI_UINT64_T, PartnerRank, RMA_MESSAGE_TAG, mInterComm, MPI_STATUS_IGNORE); // todo check return code
+
+        const auto received_key = std::make_tuple(PartnerRank, message[0], message[1]);
+        if (received_key == key) {
+            return message[2];
+        }
+        mRMAReceivedMessages[received_key].push_back(message[2]);
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+int MPIInterCommunication::GetMergedRank(
+    const int Rank,
+    const bool IsPrimary) const
+{
+    CO_SIM_IO_TRY
+
+    if (IsPrimary) {
+        return Rank;
+    }
+
+    const int primary_size = GetIsPrimaryConnection() ? GetDataCommunicator().Size() : GetPartnerInfo().Get<int>("num_processes");
+    return primary_size + Rank;
+
+    CO_SIM_IO_CATCH
+}
+
 #endif // CO_SIM_IO_BUILD_MPI_COMMUNICATION
 
 } // namespace Internals
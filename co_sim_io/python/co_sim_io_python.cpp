@@ -61,6 +61,23 @@ PYBIND11_MODULE(PyCoSimIO, m)
         rValues.Vector());
     });
 
+    // the vectors are kept alive as long as the returned Info exists, hence it should be passed to "Wait"
+    m.def("ImportDataAsync", [](const CoSimIO::Info& I_Info, CoSimIO::VectorWrapper<double>& rValues){
+        return CoSimIO::ImportDataAsync(
+        I_Info,
+        rValues.Vector());
+    }, py::keep_alive<0, 2>());
+    m.def("ExportDataAsync", [](const CoSimIO::Info& I_Info, const CoSimIO::VectorWrapper<double>& rValues){
+        return CoSimIO::ExportDataAsync(
+        I_Info,
+        rValues.Vector());
+    }, py::keep_alive<0, 2>());
+
+    m.def("Wait", &CoSimIO::Wait);
+    m.def("Test", &CoSimIO::Test);
+    m.def("GetPerformanceStatistics", &CoSimIO::GetPerformanceStatistics);
+    m.def("ResetPerformanceStatistics", &CoSimIO::ResetPerformanceStatistics);
+
     m.def("ImportInfo", &CoSimIO::ImportInfo);
     m.def("ExportInfo", &CoSimIO::ExportInfo);
 
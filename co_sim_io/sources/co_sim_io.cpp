@@ -109,6 +109,103 @@ Info CO_SIM_IO_API ExportData(
     return CoSimIO::Internals::GetConnection(connection_name).ExportData(I_Info, rData);
 }
 
+Info BorrowData(
+    const Info& I_Info,
+    const double*& O_Data,
+    std::size_t& O_Size)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).BorrowData(I_Info, O_Data, O_Size);
+}
+
+Info ReleaseData(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).ReleaseData(I_Info);
+}
+
+// Version for C++, there this input is a std::vector, which we have to wrap before passing it on
+template<>
+Info CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    std::vector<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    // the wrapper is owned by the request
+    std::shared_ptr<DataContainer<double>> p_container(new DataContainerStdVector<double>(rData));
+    return GetConnection(connection_name).ImportDataAsync(I_Info, p_container);
+}
+
+// Version for C and fortran, there we already get a container
+template<>
+Info CO_SIM_IO_API ImportDataAsync(
+    const Info& I_Info,
+    CoSimIO::Internals::DataContainer<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    // the container is owned by the caller
+    std::shared_ptr<DataContainer<double>> p_container(&rData, [](DataContainer<double>*){});
+    return GetConnection(connection_name).ImportDataAsync(I_Info, p_container);
+}
+
+// Version for C++, there this input is a std::vector, which we have to wrap before passing it on
+template<>
+Info CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const std::vector<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    // the wrapper is owned by the request
+    std::shared_ptr<const DataContainer<double>> p_container(new DataContainerStdVectorReadOnly<double>(rData));
+    return GetConnection(connection_name).ExportDataAsync(I_Info, p_container);
+}
+
+// Version for C and fortran, there we already get a container
+template<>
+Info CO_SIM_IO_API ExportDataAsync(
+    const Info& I_Info,
+    const CoSimIO::Internals::DataContainer<double>& rData)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    using namespace CoSimIO::Internals;
+    // the container is owned by the caller
+    std::shared_ptr<const DataContainer<double>> p_container(&rData, [](const DataContainer<double>*){});
+    return GetConnection(connection_name).ExportDataAsync(I_Info, p_container);
+}
+
+Info Wait(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).Wait(I_Info);
+}
+
+Info Test(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).Test(I_Info);
+}
+
+Info GetPerformanceStatistics(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    return CoSimIO::Internals::GetConnection(connection_name).GetPerformanceStatistics();
+}
+
+Info ResetPerformanceStatistics(
+    const Info& I_Info)
+{
+    const std::string connection_name = I_Info.Get<std::string>("connection_name");
+    CoSimIO::Internals::GetConnection(connection_name).ResetPerformanceStatistics();
+    return Info();
+}
+
 Info ImportMesh(
     const Info& I_Info,
     ModelPart& O_ModelPart)
@@ -0,0 +1,91 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <chrono>
+
+// Project includes
+#include "includes/communication/async_request.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+bool FutureAsyncRequest::Test()
+{
+    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void FutureAsyncRequest::WaitForCompletion()
+{
+    mFuture.wait();
+}
+
+Info FutureAsyncRequest::GetInfo()
+{
+    CO_SIM_IO_ERROR_IF_NOT(mFuture.valid()) << "The Info of this request was already retrieved!" << std::endl;
+    return mFuture.get();
+}
+
+AsyncWorker::AsyncWorker()
+{
+    mThread = std::thread(&AsyncWorker::Run, this);
+}
+
+AsyncWorker::~AsyncWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+}
+
+std::future<Info> AsyncWorker::Post(TaskType Task)
+{
+    CO_SIM_IO_TRY
+
+    std::packaged_task<Info()> packaged_task(std::move(Task));
+    std::future<Info> future = packaged_task.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        CO_SIM_IO_ERROR_IF(mStop) << "The worker was already stopped!" << std::endl;
+        mTasks.push_back(std::move(packaged_task));
+    }
+    mCondition.notify_all();
+
+    return future;
+
+    CO_SIM_IO_CATCH
+}
+
+void AsyncWorker::Run()
+{
+    while (true) {
+        std::packaged_task<Info()> task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this](){return mStop || !mTasks.empty();});
+            if (mTasks.empty()) {
+                return; // stopped and all tasks are completed
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop_front();
+        }
+
+        task(); // exceptions are stored in the future
+    }
+}
+
+} // namespace Internals
+} // namespace CoSimIO
@@ -11,13 +11,287 @@
 //
 
 // System includes
+#include <algorithm>
+#include <exception>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <cstring>
+#include <cerrno>
+#include <map>
 
 // Project includes
 #include "includes/communication/base_socket_communication.hpp"
 
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+// for SO_BUSY_POLL
+#include <sys/socket.h>
+#endif
+
 namespace CoSimIO {
 namespace Internals {
 
+namespace {
+
+// splits the data in equally sized stripes and transfers each stripe through its own socket in parallel
+// the main socket is used in the calling thread
+template<class TSocketType, class TTransferFunctionType>
+void TransferStriped(
+    TSocketType& rMainSocket,
+    const std::vector<std::shared_ptr<TSocketType>>& rAdditionalSockets,
+    const std::size_t NumBytes,
+    TTransferFunctionType&& rTransfer)
+{
+    const std::size_t num_stripes = rAdditionalSockets.size()+1;
+    const std::size_t stripe_size = (NumBytes + num_stripes - 1) / num_stripes;
+
+    std::vector<std::exception_ptr> exceptions(num_stripes);
+    std::vector<std::thread> threads;
+    threads.reserve(rAdditionalSockets.size());
+
+    for (std::size_t i=1; i<num_stripes; ++i) {
+        const std::size_t offset = std::min(i*stripe_size, NumBytes);
+        const std::size_t size = std::min(stripe_size, NumBytes-offset);
+        threads.emplace_back([&, i, offset, size](){
+            try {
+                rTransfer(*rAdditionalSockets[i-1], offset, size);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+
+    try {
+        rTransfer(rMainSocket, 0, std::min(stripe_size, NumBytes));
+    } catch (...) {
+        exceptions[0] = std::current_exception();
+    }
+
+    for (auto& r_thread : threads) {
+        r_thread.join();
+    }
+
+    for (const auto& r_exception : exceptions) {
+        if (r_exception) {std::rethrow_exception(r_exception);}
+    }
+}
+
+// the probe for determining the bandwidth-delay product
+constexpr int NUM_PROBE_ROUND_TRIPS = 10;
+constexpr std::size_t PROBE_SIZE = 4*1024*1024;
+
+// limits for the buffer sizes selected by the probe
+// setting the buffer sizes disables the automatic tuning of the kernel (Linux), hence too small buffers have to be avoided
+constexpr double MIN_TUNED_BUFFER_SIZE = 256*1024;
+constexpr double MAX_TUNED_BUFFER_SIZE = 64*1024*1024;
+
+// Nagle's algorithm only exists for TCP
+void SetNoDelay(asio::ip::tcp::socket& rSocket, const bool NoDelay)
+{
+    rSocket.set_option(asio::ip::tcp::no_delay(NoDelay));
+}
+
+void SetNoDelay(asio::local::stream_protocol::socket&, const bool) {}
+
+// the time spent waiting for the partner (e.g. for the next message) is reported separately, hence it is excluded
+double ElapsedSecondsWithoutWaiting(
+    const std::chrono::steady_clock::time_point& rStartTime,
+    const double WaitTimeAtStart)
+{
+    return Utilities::ElapsedSeconds(rStartTime) - (WaitTimer::GetAccumulatedTime() - WaitTimeAtStart);
+}
+
+} // anonymous namespace
+
+// Sends and receives messages (size in bytes followed by the payload) asynchronously
+// All operations on the socket are done in the context thread, hence no locking of the socket is required
+// - sending: the messages are queued and written one after the other
+// - receiving: the next messages are read ahead, up to the maximum number of queued messages
+template<class TSocketType>
+class BaseSocketCommunication<TSocketType>::AsyncIO
+{
+public:
+    AsyncIO(
+        TSocketType& rSocket,
+        asio::io_context& rContext,
+        const std::size_t MaxQueuedMessages)
+        : mrSocket(rSocket),
+          mrContext(rContext),
+          mMaxQueuedMessages(MaxQueuedMessages)
+    {
+        asio::post(mrContext, [this](){ StartRead(); });
+    }
+
+    // blocks if too many messages are pending
+    void Send(std::string&& rPayload)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            WaitTimer wait_timer;
+            mCondition.wait(lock, [this](){ return mNumPendingSends < mMaxQueuedMessages || !mWriteError.empty(); });
+            CO_SIM_IO_ERROR_IF_NOT(mWriteError.empty()) << "Asynchronous sending failed: " << mWriteError << std::endl;
+            ++mNumPendingSends;
+        }
+
+        auto p_message = std::make_shared<Message>();
+        p_message->Size = rPayload.size();
+        p_message->Payload = std::move(rPayload);
+
+        asio::post(mrContext, [this, p_message](){
+            mSendQueue.push_back(p_message);
+            if (mSendQueue.size() == 1) {StartWrite();}
+        });
+    }
+
+    // blocks until the next message was received
+    void Receive(std::string& rPayload)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        {
+            WaitTimer wait_timer;
+            mCondition.wait(lock, [this](){ return !mReceivedMessages.empty() || !mReadError.empty(); });
+        }
+        CO_SIM_IO_ERROR_IF(mReceivedMessages.empty()) << "Asynchronous receiving failed: " << mReadError << std::endl;
+
+        rPayload = std::move(mReceivedMessages.front());
+        mReceivedMessages.pop_front();
+
+        // continue reading ahead if it was stopped because the queue was full
+        if (!mIsReading) {
+            mIsReading = true;
+            asio::post(mrContext, [this](){ StartRead(); });
+        }
+    }
+
+    // blocks until all messages are sent
+    void Flush()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this](){ return mNumPendingSends == 0 || !mWriteError.empty(); });
+        CO_SIM_IO_ERROR_IF_NOT(mWriteError.empty()) << "Asynchronous sending failed: " << mWriteError << std::endl;
+    }
+
+private:
+    struct Message
+    {
+        std::uint64_t Size;
+        std::string Payload;
+    };
+
+    TSocketType& mrSocket;
+    asio::io_context& mrContext;
+    const std::size_t mMaxQueuedMessages;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+
+    // only accessed in the context thread
+    std::deque<std::shared_ptr<Message>> mSendQueue;
+    Message mIncomingMessage;
+
+    // protected by the mutex
+    std::size_t mNumPendingSends = 0;
+    std::deque<std::string> mReceivedMessages;
+    bool mIsReading = true;
+    std::string mWriteError;
+    std::string mReadError;
+
+    void StartWrite()
+    {
+        const Message& r_message = *mSendQueue.front();
+        const std::array<asio::const_buffer, 2> buffers {{
+            asio::buffer(&r_message.Size, sizeof(r_message.Size)),
+            asio::buffer(r_message.Payload.data(), r_message.Payload.size())
+        }};
+
+        asio::async_write(mrSocket, buffers, [this](const asio::error_code& rError, std::size_t){
+            if (rError) {
+                SetError(mWriteError, rError);
+                return;
+            }
+
+            mSendQueue.pop_front();
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                --mNumPendingSends;
+            }
+            mCondition.notify_all();
+
+            if (!mSendQueue.empty()) {StartWrite();}
+        });
+    }
+
+    void StartRead()
+    {
+        asio::async_read(mrSocket, asio::buffer(&mIncomingMessage.Size, sizeof(mIncomingMessage.Size)), [this](const asio::error_code& rError, std::size_t){
+            if (rError) {
+                SetError(mReadError, rError);
+                return;
+            }
+
+            mIncomingMessage.Payload.resize(mIncomingMessage.Size);
+            asio::async_read(mrSocket, asio::buffer(&mIncomingMessage.Payload[0], mIncomingMessage.Payload.size()), [this](const asio::error_code& rError, std::size_t){
+                if (rError) {
+                    SetError(mReadError, rError);
+                    return;
+                }
+
+                bool continue_reading;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mReceivedMessages.push_back(std::move(mIncomingMessage.Payload));
+                    continue_reading = mReceivedMessages.size() < mMaxQueuedMessages;
+                    mIsReading = continue_reading;
+                }
+                mCondition.notify_all();
+
+                mIncomingMessage.Payload = std::string();
+                if (continue_reading) {StartRead();}
+            });
+        });
+    }
+
+    void SetError(std::string& rErrorMessage, const asio::error_code& rError)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            rErrorMessage = rError.message();
+        }
+        mCondition.notify_all();
+    }
+};
+
+template<class TSocketType>
+BaseSocketCommunication<TSocketType>::BaseSocketCommunication(
+    const Info& I_Settings,
+    std::shared_ptr<DataCommunicator> I_DataComm)
+    : Communication(I_Settings, I_DataComm)
+{
+    CO_SIM_IO_TRY
+
+    mUseAsyncIO = I_Settings.Get<bool>("use_async_io", false);
+    mMaxQueuedMessages = I_Settings.Get<int>("max_queued_messages", 2);
+    CO_SIM_IO_ERROR_IF(mMaxQueuedMessages < 1) << "\"max_queued_messages\" must be at least 1, got: " << mMaxQueuedMessages << "!" << std::endl;
+
+    mTcpNoDelay = I_Settings.Get<bool>("tcp_nodelay", true);
+    mSendBufferSize = I_Settings.Get<int>("socket_send_buffer_size", 0);
+    mReceiveBufferSize = I_Settings.Get<int>("socket_receive_buffer_size", 0);
+    mBusyPoll = I_Settings.Get<int>("busy_poll", 0);
+    mAutoTuneBuffers = I_Settings.Get<bool>("auto_tune_buffers", false);
+
+    CO_SIM_IO_ERROR_IF(mSendBufferSize < 0) << "\"socket_send_buffer_size\" must not be negative, got: " << mSendBufferSize << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mReceiveBufferSize < 0) << "\"socket_receive_buffer_size\" must not be negative, got: " << mReceiveBufferSize << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mBusyPoll < 0) << "\"busy_poll\" must not be negative, got: " << mBusyPoll << "!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mAutoTuneBuffers && (mSendBufferSize > 0 || mReceiveBufferSize > 0)) << "\"auto_tune_buffers\" cannot be combined with \"socket_send_buffer_size\" or \"socket_receive_buffer_size\"!" << std::endl;
+
+#ifndef SO_BUSY_POLL
+    CO_SIM_IO_ERROR_IF(mBusyPoll > 0) << "\"busy_poll\" is only supported in Linux!" << std::endl;
+#endif
+
+    CO_SIM_IO_CATCH
+}
+
 template<class TSocketType>
 BaseSocketCommunication<TSocketType>::~BaseSocketCommunication<TSocketType>()
 {
@@ -37,10 +311,19 @@ Info BaseSocketCommunication<TSocketType>::ConnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    // done before the context thread is started, as the probe uses the sockets
+    Info info = ConfigureSockets();
+
     // required such that asio keeps listening for incoming messages
+    // the work guard keeps the context running also if no asynchronous operations are pending
+    mpWorkGuard = CoSimIO::make_unique<asio::executor_work_guard<asio::io_context::executor_type>>(mAsioContext.get_executor());
     mContextThread = std::thread([this]() { mAsioContext.run(); });
 
-    return Info();
+    if (mUseAsyncIO) {
+        mpAsyncIO = CoSimIO::make_unique<AsyncIO>(*mpAsioSocket, mAsioContext, static_cast<std::size_t>(mMaxQueuedMessages));
+    }
+
+    return info;
 
     CO_SIM_IO_CATCH
 }
@@ -50,14 +333,36 @@ Info BaseSocketCommunication<TSocketType>::DisconnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    // all queued messages have to be sent before disconnecting
+    if (mpAsyncIO) {
+        mpAsyncIO->Flush();
+    }
+
     // Request the context to close
+    mpWorkGuard.reset();
     mAsioContext.stop();
 
     // Tidy up the context thread
     if (mContextThread.joinable()) mContextThread.join();
 
-    mpAsioSocket->close();
-    mpAsioSocket.reset(); // important to release the resouces (otherwise crashes in Win with release compilation)
+    if (mpAsioSocket) {
+        mpAsioSocket->close();
+        mpAsioSocket.reset(); // important to release the resouces (otherwise crashes in Win with release compilation)
+    }
+
+    for (auto& r_socket : mPartnerAsioSockets) {
+        r_socket.second->close();
+        r_socket.second.reset();
+    }
+    mPartnerAsioSockets.clear();
+
+    for (auto& rp_socket : mAdditionalAsioSockets) {
+        rp_socket->close();
+        rp_socket.reset();
+    }
+    mAdditionalAsioSockets.clear();
+
+    mpAsyncIO.reset();
 
     return Info();
 
@@ -71,10 +376,17 @@ double BaseSocketCommunication<TSocketType>::SendString(
 {
     CO_SIM_IO_TRY
 
-    SendSize(rData.size()); // serves also as synchronization for time measurement
+    if (mpAsyncIO) {
+        const auto start_time(std::chrono::steady_clock::now());
+        const double wait_time_at_start = WaitTimer::GetAccumulatedTime();
+        mpAsyncIO->Send(std::string(rData)); // copy required as the data has to stay alive until it is sent
+        return ElapsedSecondsWithoutWaiting(start_time, wait_time_at_start);
+    }
+
+    TSocketType& r_socket = GetAsioSocket(I_Info);
 
     const auto start_time(std::chrono::steady_clock::now());
-    asio::write(*mpAsioSocket, asio::buffer(rData.data(), rData.size()));
+    SendSizeAndData(r_socket, rData.size(), rData.data(), rData.size());
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -87,11 +399,19 @@ double BaseSocketCommunication<TSocketType>::ReceiveString(
 {
     CO_SIM_IO_TRY
 
-    std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
+    if (mpAsyncIO) {
+        const auto start_time(std::chrono::steady_clock::now());
+        const double wait_time_at_start = WaitTimer::GetAccumulatedTime();
+        mpAsyncIO->Receive(rData);
+        return ElapsedSecondsWithoutWaiting(start_time, wait_time_at_start);
+    }
+
+    TSocketType& r_socket = GetAsioSocket(I_Info);
+    std::size_t received_size = ReceiveSize(r_socket); // serves also as synchronization for time measurement
 
     const auto start_time(std::chrono::steady_clock::now());
     rData.resize(received_size);
-    asio::read(*mpAsioSocket, asio::buffer(&(rData.front()), received_size));
+    ReadData(r_socket, &(rData.front()), received_size);
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -104,10 +424,17 @@ double BaseSocketCommunication<TSocketType>::SendDataContainer(
 {
     CO_SIM_IO_TRY
 
-    SendSize(rData.size()); // serves also as synchronization for time measurement
+    if (mpAsyncIO) {
+        const auto start_time(std::chrono::steady_clock::now());
+        const double wait_time_at_start = WaitTimer::GetAccumulatedTime();
+        mpAsyncIO->Send(std::string(reinterpret_cast<const char*>(rData.data()), rData.size()*sizeof(double)));
+        return ElapsedSecondsWithoutWaiting(start_time, wait_time_at_start);
+    }
+
+    TSocketType& r_socket = GetAsioSocket(I_Info);
 
     const auto start_time(std::chrono::steady_clock::now());
-    asio::write(*mpAsioSocket, asio::buffer(rData.data(), rData.size()*sizeof(double)));
+    SendSizeAndData(r_socket, rData.size(), reinterpret_cast<const char*>(rData.data()), rData.size()*sizeof(double));
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
@@ -120,38 +447,310 @@ double BaseSocketCommunication<TSocketType>::ReceiveDataContainer(
 {
     CO_SIM_IO_TRY
 
-    std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
+    if (mpAsyncIO) {
+        const auto start_time(std::chrono::steady_clock::now());
+        const double wait_time_at_start = WaitTimer::GetAccumulatedTime();
+        std::string message;
+        mpAsyncIO->Receive(message);
+        CO_SIM_IO_ERROR_IF(message.size()%sizeof(double) != 0) << "Received message has the wrong size for a DataContainer: " << message.size() << " bytes!" << std::endl;
+        rData.resize(message.size()/sizeof(double));
+        if (!message.empty()) {
+            std::memcpy(rData.data(), message.data(), message.size());
+        }
+        return ElapsedSecondsWithoutWaiting(start_time, wait_time_at_start);
+    }
+
+    TSocketType& r_socket = GetAsioSocket(I_Info);
+    std::size_t received_size = ReceiveSize(r_socket); // serves also as synchronization for time measurement
 
     const auto start_time(std::chrono::steady_clock::now());
     rData.resize(received_size);
-    asio::read(*mpAsioSocket, asio::buffer(rData.data(), rData.size()*sizeof(double)));
+    ReadData(r_socket, reinterpret_cast<char*>(rData.data()), rData.size()*sizeof(double));
     return Utilities::ElapsedSeconds(start_time);
 
     CO_SIM_IO_CATCH
 }
 
 template<class TSocketType>
-void BaseSocketCommunication<TSocketType>::SendSize(const std::uint64_t Size)
+TSocketType& BaseSocketCommunication<TSocketType>::GetAsioSocket(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (mPartnerAsioSockets.empty()) {
+        return *mpAsioSocket;
+    }
+
+    const int partner_rank = GetPartnerRank(I_Info);
+    const auto it_socket = mPartnerAsioSockets.find(partner_rank);
+    CO_SIM_IO_ERROR_IF(it_socket == mPartnerAsioSockets.end()) << "No socket exists for partner rank " << partner_rank << "!" << std::endl;
+    return *(it_socket->second);
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::SendSize(
+    TSocketType& rSocket,
+    const std::uint64_t Size)
+{
+    CO_SIM_IO_TRY
+
+    asio::write(rSocket, asio::buffer(&Size, sizeof(Size)));
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::SendSizeAndData(
+    TSocketType& rSocket,
+    const std::uint64_t Size,
+    const char* pData,
+    const std::size_t NumBytes)
 {
     CO_SIM_IO_TRY
 
-    asio::write(*mpAsioSocket, asio::buffer(&Size, sizeof(Size)));
+    if (mAdditionalAsioSockets.empty() || NumBytes < mStripingThreshold) {
+        // gather-write, this avoids sending the small size in a separate segment
+        const std::array<asio::const_buffer, 2> buffers {{
+            asio::buffer(&Size, sizeof(Size)),
+            asio::buffer(pData, NumBytes)
+        }};
+        asio::write(rSocket, buffers);
+    } else {
+        SendSize(rSocket, Size);
+        WriteData(rSocket, pData, NumBytes);
+    }
 
     CO_SIM_IO_CATCH
 }
 
 template<class TSocketType>
-std::uint64_t BaseSocketCommunication<TSocketType>::ReceiveSize()
+std::uint64_t BaseSocketCommunication<TSocketType>::ReceiveSize(TSocketType& rSocket)
 {
     CO_SIM_IO_TRY
 
+    WaitTimer wait_timer; // blocks until the partner sends
     std::uint64_t imp_size_u;
-    asio::read(*mpAsioSocket, asio::buffer(&imp_size_u, sizeof(imp_size_u)));
+    asio::read(rSocket, asio::buffer(&imp_size_u, sizeof(imp_size_u)));
     return imp_size_u;
 
     CO_SIM_IO_CATCH
 }
 
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::WriteData(
+    TSocketType& rSocket,
+    const char* pData,
+    const std::size_t NumBytes)
+{
+    CO_SIM_IO_TRY
+
+    if (mAdditionalAsioSockets.empty() || NumBytes < mStripingThreshold) {
+        asio::write(rSocket, asio::buffer(pData, NumBytes));
+    } else {
+        TransferStriped(rSocket, mAdditionalAsioSockets, NumBytes, [pData](TSocketType& rStripeSocket, const std::size_t Offset, const std::size_t Size){
+            asio::write(rStripeSocket, asio::buffer(pData+Offset, Size));
+        });
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::ReadData(
+    TSocketType& rSocket,
+    char* pData,
+    const std::size_t NumBytes)
+{
+    CO_SIM_IO_TRY
+
+    // the stripes are received directly into their position in the destination
+    if (mAdditionalAsioSockets.empty() || NumBytes < mStripingThreshold) {
+        asio::read(rSocket, asio::buffer(pData, NumBytes));
+    } else {
+        TransferStriped(rSocket, mAdditionalAsioSockets, NumBytes, [pData](TSocketType& rStripeSocket, const std::size_t Offset, const std::size_t Size){
+            asio::read(rStripeSocket, asio::buffer(pData+Offset, Size));
+        });
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+Info BaseSocketCommunication<TSocketType>::ConfigureSockets()
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+
+    // the partner sockets are probed in the order of the ranks, this way the probes are done in the same order on both sides
+    std::map<int, TSocketType*> partner_sockets;
+    for (auto& r_socket : mPartnerAsioSockets) {
+        partner_sockets[r_socket.first] = r_socket.second.get();
+    }
+
+    if (mpAsioSocket) {
+        // the main and the additional sockets use the same buffer sizes
+        int send_buffer_size = mSendBufferSize;
+        int receive_buffer_size = mReceiveBufferSize;
+        ConfigureSocket(*mpAsioSocket, send_buffer_size, receive_buffer_size);
+
+        if (mAutoTuneBuffers) {
+            info = ProbeBandwidthDelayProduct(*mpAsioSocket);
+            send_buffer_size = receive_buffer_size = info.Get<int>("tuned_buffer_size");
+            ConfigureSocket(*mpAsioSocket, send_buffer_size, receive_buffer_size);
+        }
+
+        for (auto& rp_socket : mAdditionalAsioSockets) {
+            ConfigureSocket(*rp_socket, send_buffer_size, receive_buffer_size);
+        }
+    }
+
+    for (auto& r_socket : partner_sockets) {
+        ConfigureSocket(*r_socket.second, mSendBufferSize, mReceiveBufferSize);
+
+        if (mAutoTuneBuffers) {
+            // the largest buffer size is reported
+            Info probe_info = ProbeBandwidthDelayProduct(*r_socket.second);
+            const int buffer_size = probe_info.Get<int>("tuned_buffer_size");
+            ConfigureSocket(*r_socket.second, buffer_size, buffer_size);
+            if (!info.Has("tuned_buffer_size") || buffer_size > info.Get<int>("tuned_buffer_size")) {
+                info = probe_info;
+            }
+        }
+    }
+
+    // reporting the buffer sizes that are actually used (the operating system might adjust them)
+    TSocketType* p_socket = mpAsioSocket ? mpAsioSocket.get() : (partner_sockets.empty() ? nullptr : partner_sockets.begin()->second);
+    if (p_socket) {
+        asio::socket_base::send_buffer_size send_buffer_size;
+        asio::socket_base::receive_buffer_size receive_buffer_size;
+        p_socket->get_option(send_buffer_size);
+        p_socket->get_option(receive_buffer_size);
+        info.Set<int>("socket_send_buffer_size", send_buffer_size.value());
+        info.Set<int>("socket_receive_buffer_size", receive_buffer_size.value());
+    }
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::ConfigureSocket(
+    TSocketType& rSocket,
+    const int SendBufferSize,
+    const int ReceiveBufferSize)
+{
+    CO_SIM_IO_TRY
+
+    SetNoDelay(rSocket, mTcpNoDelay);
+
+    // zero means that the default of the operating system is used
+    if (SendBufferSize > 0) {
+        rSocket.set_option(asio::socket_base::send_buffer_size(SendBufferSize));
+    }
+    if (ReceiveBufferSize > 0) {
+        rSocket.set_option(asio::socket_base::receive_buffer_size(ReceiveBufferSize));
+    }
+
+#ifdef SO_BUSY_POLL
+    if (mBusyPoll > 0) {
+        // increasing it beyond the system default (net.core.busy_read) requires elevated privileges, hence failing is not an error
+        const int busy_poll = mBusyPoll;
+        CO_SIM_IO_INFO_IF("CoSimIO", ::setsockopt(rSocket.native_handle(), SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) != 0) << "Warning: \"busy_poll\" could not be set: " << std::strerror(errno) << std::endl;
+    }
+#endif
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+Info BaseSocketCommunication<TSocketType>::ProbeBandwidthDelayProduct(TSocketType& rSocket)
+{
+    CO_SIM_IO_TRY
+
+    std::uint64_t ping = 0;
+    std::vector<char> probe_data(PROBE_SIZE);
+    std::array<double, 3> results; // round trip time, bandwidth, buffer size
+
+    if (GetIsPrimaryConnection()) {
+        // the minimum is used, as it is the least affected by other activity on the machine
+        double round_trip_time = std::numeric_limits<double>::max();
+        for (int i=0; i<NUM_PROBE_ROUND_TRIPS; ++i) {
+            const auto start_time(std::chrono::steady_clock::now());
+            asio::write(rSocket, asio::buffer(&ping, sizeof(ping)));
+            asio::read(rSocket, asio::buffer(&ping, sizeof(ping)));
+            round_trip_time = std::min(round_trip_time, Utilities::ElapsedSeconds(start_time));
+        }
+
+        // the partner acknowledges once it received all data, which takes about one round trip in addition to the transfer
+        const auto start_time(std::chrono::steady_clock::now());
+        asio::write(rSocket, asio::buffer(probe_data));
+        asio::read(rSocket, asio::buffer(&ping, sizeof(ping)));
+        const double transfer_time = std::max(Utilities::ElapsedSeconds(start_time) - round_trip_time, 1e-9);
+
+        const double bandwidth = PROBE_SIZE / transfer_time;
+
+        // twice the bandwidth-delay product, such that the sender does not have to wait for acknowledgements
+        const double buffer_size = std::min(std::max(2.0*bandwidth*round_trip_time, MIN_TUNED_BUFFER_SIZE), MAX_TUNED_BUFFER_SIZE);
+
+        results = {{round_trip_time, bandwidth, buffer_size}};
+        asio::write(rSocket, asio::buffer(results));
+    } else {
+        for (int i=0; i<NUM_PROBE_ROUND_TRIPS; ++i) {
+            asio::read(rSocket, asio::buffer(&ping, sizeof(ping)));
+            asio::write(rSocket, asio::buffer(&ping, sizeof(ping)));
+        }
+
+        asio::read(rSocket, asio::buffer(probe_data));
+        asio::write(rSocket, asio::buffer(&ping, sizeof(ping)));
+
+        asio::read(rSocket, asio::buffer(results));
+    }
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1) << "Measured round trip time: " << results[0] << " [s], bandwidth: " << results[1] << " [bytes/s], using buffer size: " << static_cast<int>(results[2]) << " [bytes]" << std::endl;
+
+    Info info;
+    info.Set<double>("round_trip_time", results[0]);
+    info.Set<double>("bandwidth", results[1]);
+    info.Set<int>("tuned_buffer_size", static_cast<int>(results[2]));
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+void BaseSocketCommunication<TSocketType>::DerivedHandShake() const
+{
+    CO_SIM_IO_TRY
+
+    const bool my_use_async_io = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_async_io");
+    const bool partner_use_async_io = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_async_io");
+    CO_SIM_IO_ERROR_IF(my_use_async_io != partner_use_async_io) << std::boolalpha << "Mismatch in use_async_io!\nMy use_async_io: " << my_use_async_io << "\nPartner use_async_io: " << partner_use_async_io << std::noboolalpha << std::endl;
+
+    const bool my_auto_tune_buffers = GetMyInfo().Get<Info>("communication_settings").Get<bool>("auto_tune_buffers");
+    const bool partner_auto_tune_buffers = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("auto_tune_buffers");
+    CO_SIM_IO_ERROR_IF(my_auto_tune_buffers != partner_auto_tune_buffers) << std::boolalpha << "Mismatch in auto_tune_buffers!\nMy auto_tune_buffers: " << my_auto_tune_buffers << "\nPartner auto_tune_buffers: " << partner_auto_tune_buffers << std::noboolalpha << std::endl;
+
+    CO_SIM_IO_CATCH
+}
+
+template<class TSocketType>
+Info BaseSocketCommunication<TSocketType>::GetCommunicationSettings() const
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+    info.Set("use_async_io", mUseAsyncIO);
+    info.Set("auto_tune_buffers", mAutoTuneBuffers);
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
 template class BaseSocketCommunication<asio::ip::tcp::socket>;
 template class BaseSocketCommunication<asio::local::stream_protocol::socket>;
 
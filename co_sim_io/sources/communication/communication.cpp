@@ -11,12 +11,14 @@
 //
 
 // System includes
-#include <thread>
+#include <algorithm>
+#include <set>
 #include <system_error>
 
 // Project includes
 #include "includes/communication/communication.hpp"
 #include "includes/file_serializer.hpp"
+#include "includes/mesh_codec.hpp"
 #include "includes/utilities.hpp"
 #include "includes/version.hpp"
 
@@ -36,6 +38,86 @@ void AddFilePermissions(const fs::path& rPath)
     CO_SIM_IO_CATCH
 }
 
+namespace {
+
+Info AddPartnerRank(const Info& I_Info, const int PartnerRank)
+{
+    Info info(I_Info);
+    info.Set<int>("partner_rank", PartnerRank);
+    return info;
+}
+
+// sums up the timings and the memory usage of the operations with the individual partner ranks
+void AccumulateOperationInfo(const Info& I_Info, Info& rTotalInfo)
+{
+    for (const char* p_key : {"elapsed_time", "elapsed_time_ipc", "elapsed_time_serializer"}) {
+        if (I_Info.Has(p_key)) {
+            rTotalInfo.Set<double>(p_key, rTotalInfo.Get<double>(p_key, 0.0) + I_Info.Get<double>(p_key));
+        }
+    }
+    rTotalInfo.Set<std::size_t>("memory_usage_ipc", rTotalInfo.Get<std::size_t>("memory_usage_ipc", 0) + I_Info.Get<std::size_t>("memory_usage_ipc"));
+}
+
+// merges the chunks received from the partner ranks into one ModelPart
+// the partition indices of the ghost nodes refer to the ranks of the partner, they are translated to the ranks that own the nodes after the redistribution
+void MergeModelPartChunks(
+    const std::vector<std::unique_ptr<ModelPart>>& rChunks,
+    ModelPart& O_ModelPart,
+    const int MyRank,
+    const int MySize,
+    const int PartnerSize)
+{
+    CO_SIM_IO_TRY
+
+    O_ModelPart.Clear();
+
+    std::unordered_set<IdType> node_ids;
+
+    // local nodes first, as a node that is a ghost node in one chunk can be a local node in another one
+    for (const auto& rp_chunk : rChunks) {
+        for (auto it_node=rp_chunk->LocalNodesBegin(); it_node!=rp_chunk->LocalNodesEnd(); ++it_node) {
+            const Node& r_node = **it_node;
+            if (node_ids.insert(r_node.Id()).second) {
+                O_ModelPart.CreateNewNode(r_node.Id(), r_node.X(), r_node.Y(), r_node.Z());
+            }
+        }
+    }
+
+    for (const auto& rp_chunk : rChunks) {
+        for (const auto& r_partition : rp_chunk->GetPartitionModelParts()) {
+            const int owner_rank = static_cast<int>(*Utilities::ComputePartnerRanksAsExporter(r_partition.first, PartnerSize, MySize).begin());
+            for (auto it_node=r_partition.second->NodesBegin(); it_node!=r_partition.second->NodesEnd(); ++it_node) {
+                const Node& r_node = **it_node;
+                if (!node_ids.insert(r_node.Id()).second) {continue;}
+                if (owner_rank == MyRank) {
+                    O_ModelPart.CreateNewNode(r_node.Id(), r_node.X(), r_node.Y(), r_node.Z());
+                } else {
+                    O_ModelPart.CreateNewGhostNode(r_node.Id(), r_node.X(), r_node.Y(), r_node.Z(), owner_rank);
+                }
+            }
+        }
+    }
+
+    std::unordered_set<IdType> element_ids;
+    ConnectivitiesType connectivities;
+
+    for (const auto& rp_chunk : rChunks) {
+        for (auto it_elem=rp_chunk->ElementsBegin(); it_elem!=rp_chunk->ElementsEnd(); ++it_elem) {
+            const Element& r_elem = **it_elem;
+            if (!element_ids.insert(r_elem.Id()).second) {continue;}
+            connectivities.clear();
+            for (auto it_node=r_elem.NodesBegin(); it_node!=r_elem.NodesEnd(); ++it_node) {
+                connectivities.push_back((*it_node)->Id());
+            }
+            O_ModelPart.CreateNewElement(r_elem.Id(), r_elem.Type(), connectivities);
+        }
+    }
+
+    CO_SIM_IO_CATCH
+}
+
+} // anonymous namespace
+
 Communication::Communication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
@@ -65,12 +147,25 @@ Communication::Communication(
         mSerializerTraceType = Serializer::StringToTraceType(I_Settings.Get<std::string>("serializer_trace_type"));
     }
 
+    if (I_Settings.Has("file_wait_strategy")) {
+        mFileWaitStrategy = Utilities::StringToFileWaitStrategy(I_Settings.Get<std::string>("file_wait_strategy"));
+    }
+
     mCommInFolder = I_Settings.Get<bool>("use_folder_for_communication", true);
     mCommFolder = GetWorkingDirectory();
     if (mCommInFolder) {
         mCommFolder /= ".CoSimIOComm_" + GetConnectionName();
     }
 
+    const fs::path trace_file(I_Settings.Get<std::string>("trace_file", ""));
+    if (!trace_file.empty()) {
+        // each rank writes its own file, the rank is appended to the name
+        fs::path trace_file_name = trace_file.is_absolute() ? trace_file : mWorkingDirectory / trace_file;
+        const std::string extension = trace_file.has_extension() ? trace_file.extension().string() : ".json";
+        trace_file_name.replace_filename(trace_file.stem().string() + "_" + std::to_string(mpDataComm->Rank()) + extension);
+        mpTracer = CoSimIO::make_unique<Tracer>(trace_file_name, mMyName + " (rank " + std::to_string(mpDataComm->Rank()) + ")");
+    }
+
     CO_SIM_IO_CATCH
 }
 
@@ -87,6 +182,8 @@ Info Communication::Connect(const Info& I_Info)
 
     CO_SIM_IO_ERROR_IF(mIsConnected) << "A connection was already established!" << std::endl;
 
+    TraceScope trace_scope(GetTracer(), "Connect", "connection", mConnectionName);
+
     BaseConnectDetail(I_Info);
 
     PrepareConnection(I_Info);
@@ -115,11 +212,31 @@ Info Communication::Disconnect(const Info& I_Info)
     CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Disconnecting \"" << mConnectionName << "\" ..." << std::endl;
 
     if (mIsConnected) {
-        Info disconnect_detail_info = DisconnectDetail(I_Info);
-        mIsConnected = false;
-        disconnect_detail_info.Set<bool>("is_connected", false);
+        // the requests have to be completed before the communication is closed
+        if (!mPendingRequests.empty()) {
+            CO_SIM_IO_INFO("CoSimIO") << "Warning: " << mPendingRequests.size() << " asynchronous request(s) were not completed with \"Wait\", completing them now!" << std::endl;
+            CompletePendingRequests(AsyncDirection::Import);
+            CompletePendingRequests(AsyncDirection::Export);
+            mPendingRequests.clear();
+        }
+        mpImportWorker.reset();
+        mpExportWorker.reset();
+
+        Info disconnect_detail_info;
+        {
+            TraceScope trace_scope(GetTracer(), "Disconnect", "connection", mConnectionName);
+
+            disconnect_detail_info = DisconnectDetail(I_Info);
+            mIsConnected = false;
+            disconnect_detail_info.Set<bool>("is_connected", false);
+
+            BaseDisconnectDetail(I_Info);
+        }
 
-        BaseDisconnectDetail(I_Info);
+        if (mpTracer) {
+            mpTracer->WriteFile();
+            CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Trace was written to " << mpTracer->GetFileName() << std::endl;
+        }
 
         if (mIsConnected) {
             CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not successful!" << std::endl;
@@ -213,6 +330,7 @@ Info Communication::ImportDataImpl(
         return ReceiveObjectWithStreamSerializer(I_Info, rData);
     } else {
         Info info;
+        TraceScope trace_scope(GetTracer(), "transfer", "phase");
         const double elapsed_time = ReceiveDataContainer(I_Info, rData);
         info.Set<double>("elapsed_time", elapsed_time);
         info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
@@ -232,6 +350,7 @@ Info Communication::ExportDataImpl(
         return SendObjectWithStreamSerializer(I_Info, rData);
     } else {
         Info info;
+        TraceScope trace_scope(GetTracer(), "transfer", "phase");
         const double elapsed_time = SendDataContainer(I_Info, rData);
         info.Set<double>("elapsed_time", elapsed_time);
         info.Set<std::size_t>("memory_usage_ipc", rData.size()*sizeof(double));
@@ -241,13 +360,220 @@ Info Communication::ExportDataImpl(
     CO_SIM_IO_CATCH
 }
 
+Info Communication::BorrowDataImpl(
+    const Info& I_Info,
+    const double*& O_Data,
+    std::size_t& O_Size)
+{
+    CO_SIM_IO_TRY
+
+    // the buffer is kept for the next time to avoid reallocations
+    std::vector<double>& r_buffer = mBorrowBuffers[I_Info.Get<std::string>("identifier")];
+    DataContainerStdVector<double> container(r_buffer);
+
+    Info info = mIsMToNConnection ? ImportDataMToN(I_Info, container) : ImportDataImpl(I_Info, container);
+    O_Data = r_buffer.data();
+    O_Size = r_buffer.size();
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportDataAsync(
+    const Info& I_Info,
+    std::shared_ptr<Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    CheckConnection(I_Info);
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Starting asynchronous import of Data \"" << I_Info.Get<std::string>("identifier") << "\"" << std::endl;
+
+    return StartAsyncRequest(I_Info, AsyncDirection::Import, ImportDataAsyncImpl(I_Info, pData));
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportDataAsync(
+    const Info& I_Info,
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    CheckConnection(I_Info);
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Starting asynchronous export of Data \"" << I_Info.Get<std::string>("identifier") << "\"" << std::endl;
+
+    // the data is exported to a single partner rank, hence the same request can be used for M:N
+    const Info i_info = mIsMToNConnection ? AddPartnerRank(I_Info, mPartnerRanksAsExporter.front()) : I_Info;
+
+    return StartAsyncRequest(I_Info, AsyncDirection::Export, ExportDataAsyncImpl(i_info, pData));
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::Wait(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF_NOT(mIsConnected) << "No active connection exists!" << std::endl;
+
+    const int request_id = I_Info.Get<int>("request_id");
+    auto it_request = mPendingRequests.find(request_id);
+    CO_SIM_IO_ERROR_IF(it_request == mPendingRequests.end()) << "Request " << request_id << " does not exist or was already completed!" << std::endl;
+
+    TraceScope trace_scope(GetTracer(), "Wait", "operation", it_request->second.InputInfo.Get<std::string>("identifier"));
+
+    const auto start_time(std::chrono::steady_clock::now());
+    CompletePendingRequests(it_request->second.Direction, request_id);
+    const double wait_time = Utilities::ElapsedSeconds(start_time);
+
+    // the request is removed also if it failed
+    const PendingRequest request(std::move(it_request->second));
+    mPendingRequests.erase(it_request);
+
+    Info o_info = request.pRequest->GetInfo();
+    // the operation progresses in the background, hence only the time blocked in "Wait" counts as waiting
+    o_info.Set<double>("elapsed_time_wait", wait_time);
+
+    PostChecks(o_info);
+
+    const bool is_import = request.Direction == AsyncDirection::Import;
+    CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1 && mpDataComm->Rank()==0) << "Finished asynchronous " << (is_import ? "import" : "export") << " of Data \"" << request.InputInfo.Get<std::string>("identifier") << "\"" << std::endl;
+
+    PrintElapsedTime(request.InputInfo, o_info, is_import ? "Import data (async)" : "Export data (async)");
+
+    mPerformanceStatistics.Record(
+        request.InputInfo.Get<std::string>("identifier"),
+        is_import ? "import_data_async" : "export_data_async",
+        o_info.Get<double>("elapsed_time"),
+        o_info.Get<double>("elapsed_time_wait"),
+        o_info);
+
+    return o_info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::Test(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF_NOT(mIsConnected) << "No active connection exists!" << std::endl;
+
+    const int request_id = I_Info.Get<int>("request_id");
+    const auto it_request = mPendingRequests.find(request_id);
+    CO_SIM_IO_ERROR_IF(it_request == mPendingRequests.end()) << "Request " << request_id << " does not exist or was already completed!" << std::endl;
+
+    // a request can only be completed after the previous requests of the same direction
+    bool is_completed = true;
+    for (auto it = mPendingRequests.begin(); it != std::next(it_request); ++it) {
+        if (it->second.Direction == it_request->second.Direction) {
+            is_completed = it->second.pRequest->Test();
+            if (!is_completed) {break;}
+        }
+    }
+
+    Info info;
+    info.Set<bool>("is_completed", is_completed);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+std::unique_ptr<AsyncRequest> Communication::ImportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    if (!mpImportWorker) {
+        mpImportWorker = CoSimIO::make_unique<AsyncWorker>();
+    }
+
+    // the task keeps the data alive until the request is completed
+    return CoSimIO::make_unique<FutureAsyncRequest>(mpImportWorker->Post([this, I_Info, pData](){
+        return mIsMToNConnection ? ImportDataMToN(I_Info, *pData) : ImportDataImpl(I_Info, *pData);
+    }));
+
+    CO_SIM_IO_CATCH
+}
+
+std::unique_ptr<AsyncRequest> Communication::ExportDataAsyncImpl(
+    const Info& I_Info,
+    std::shared_ptr<const Internals::DataContainer<double>> pData)
+{
+    CO_SIM_IO_TRY
+
+    if (!mpExportWorker) {
+        mpExportWorker = CoSimIO::make_unique<AsyncWorker>();
+    }
+
+    // the task keeps the data alive until the request is completed
+    return CoSimIO::make_unique<FutureAsyncRequest>(mpExportWorker->Post([this, I_Info, pData](){
+        return ExportDataImpl(I_Info, *pData);
+    }));
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::GetPerformanceStatistics() const
+{
+    return mPerformanceStatistics.GetInfo();
+}
+
+void Communication::ResetPerformanceStatistics()
+{
+    mPerformanceStatistics.Reset();
+}
+
+Info Communication::StartAsyncRequest(
+    const Info& I_Info,
+    const AsyncDirection Direction,
+    std::unique_ptr<AsyncRequest> pRequest)
+{
+    CO_SIM_IO_TRY
+
+    const int request_id = mNextRequestId++;
+
+    PendingRequest& r_request = mPendingRequests[request_id];
+    r_request.Direction = Direction;
+    r_request.InputInfo = I_Info;
+    r_request.pRequest = std::move(pRequest);
+
+    Info info;
+    info.Set<std::string>("connection_name", GetConnectionName());
+    info.Set<int>("request_id", request_id);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+void Communication::CompletePendingRequests(
+    const AsyncDirection Direction,
+    const int UntilRequestId)
+{
+    CO_SIM_IO_TRY
+
+    for (auto& r_request : mPendingRequests) {
+        if (UntilRequestId >= 0 && r_request.first > UntilRequestId) {break;}
+        if (r_request.second.Direction == Direction) {
+            TraceScope trace_scope(GetTracer(), "wait", "phase", r_request.second.InputInfo.Get<std::string>("identifier"));
+            r_request.second.pRequest->WaitForCompletion();
+        }
+    }
+
+    CO_SIM_IO_CATCH
+}
+
 Info Communication::ImportMeshImpl(
     const Info& I_Info,
     ModelPart& O_ModelPart)
 {
     CO_SIM_IO_TRY
 
-    return ReceiveObjectWithStreamSerializer(I_Info, O_ModelPart);
+    MeshCodec mesh_codec(O_ModelPart);
+    return ReceiveObjectWithStreamSerializer(I_Info, mesh_codec);
 
     CO_SIM_IO_CATCH
 }
@@ -258,7 +584,147 @@ Info Communication::ExportMeshImpl(
 {
     CO_SIM_IO_TRY
 
-    return SendObjectWithStreamSerializer(I_Info, I_ModelPart);
+    return SendObjectWithStreamSerializer(I_Info, MeshCodec(I_ModelPart));
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportInfoMToN(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    // all partner ranks send the same Info, the one from the first partner rank is used
+    Info imported_info;
+    Info total_info;
+    total_info.Set<double>("elapsed_time", 0.0);
+    total_info.Set<std::size_t>("memory_usage_ipc", 0);
+
+    for (const int partner_rank : mPartnerRanksAsImporter) {
+        Info rank_info = ImportInfoImpl(AddPartnerRank(I_Info, partner_rank));
+        AccumulateOperationInfo(rank_info, total_info);
+        if (partner_rank == mPartnerRanksAsImporter.front()) {
+            imported_info = rank_info;
+        }
+    }
+
+    // the ranks without partner ranks get the Info from rank 0 (which always has a partner rank)
+    mpDataComm->Broadcast(imported_info, 0);
+
+    imported_info.Erase("partner_rank");
+    imported_info.Erase("elapsed_time_ipc");
+    imported_info.Erase("elapsed_time_serializer");
+    imported_info.Set<double>("elapsed_time", 0.0);
+    imported_info.Set<std::size_t>("memory_usage_ipc", 0);
+    AccumulateOperationInfo(total_info, imported_info);
+    return imported_info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportInfoMToN(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    return ExportInfoImpl(AddPartnerRank(I_Info, mPartnerRanksAsExporter.front()));
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportDataMToN(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+    info.Set<double>("elapsed_time", 0.0);
+    info.Set<std::size_t>("memory_usage_ipc", 0);
+
+    if (mPartnerRanksAsImporter.empty()) {
+        rData.resize(0);
+        return info;
+    }
+
+    // the first segment is imported directly, the following ones are appended in the order of the partner ranks
+    AccumulateOperationInfo(ImportDataImpl(AddPartnerRank(I_Info, mPartnerRanksAsImporter.front()), rData), info);
+
+    std::vector<double> segment;
+    DataContainerStdVector<double> segment_container(segment);
+
+    for (std::size_t i=1; i<mPartnerRanksAsImporter.size(); ++i) {
+        AccumulateOperationInfo(ImportDataImpl(AddPartnerRank(I_Info, mPartnerRanksAsImporter[i]), segment_container), info);
+
+        const auto start_time(std::chrono::steady_clock::now());
+        const std::size_t previous_size = rData.size();
+        rData.resize(previous_size+segment.size());
+        std::copy(segment.begin(), segment.end(), rData.data()+previous_size);
+        info.Set<double>("elapsed_time", info.Get<double>("elapsed_time") + Utilities::ElapsedSeconds(start_time));
+    }
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportDataMToN(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    return ExportDataImpl(AddPartnerRank(I_Info, mPartnerRanksAsExporter.front()), rData);
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ImportMeshMToN(
+    const Info& I_Info,
+    ModelPart& O_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+    info.Set<double>("elapsed_time", 0.0);
+    info.Set<std::size_t>("memory_usage_ipc", 0);
+
+    std::vector<std::unique_ptr<ModelPart>> chunks;
+    for (const int partner_rank : mPartnerRanksAsImporter) {
+        chunks.push_back(CoSimIO::make_unique<ModelPart>(O_ModelPart.Name()));
+        AccumulateOperationInfo(ImportMeshImpl(AddPartnerRank(I_Info, partner_rank), *chunks.back()), info);
+    }
+
+    const auto start_time(std::chrono::steady_clock::now());
+    MergeModelPartChunks(chunks, O_ModelPart, mpDataComm->Rank(), mpDataComm->Size(), mPartnerInfo.Get<int>("num_processes"));
+    info.Set<double>("elapsed_time", info.Get<double>("elapsed_time") + Utilities::ElapsedSeconds(start_time));
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ExportMeshMToN(
+    const Info& I_Info,
+    const ModelPart& I_ModelPart)
+{
+    CO_SIM_IO_TRY
+
+    return ExportMeshImpl(AddPartnerRank(I_Info, mPartnerRanksAsExporter.front()), I_ModelPart);
+
+    CO_SIM_IO_CATCH
+}
+
+Info Communication::ReleaseData(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CheckConnection(I_Info);
+
+    const std::string identifier = I_Info.Get<std::string>("identifier");
+    CO_SIM_IO_ERROR_IF(mBorrowedIdentifiers.count(identifier) == 0) << "Data for \"" << identifier << "\" cannot be released as it was not borrowed!" << std::endl;
+
+    Info info = ReleaseDataImpl(I_Info);
+    mBorrowedIdentifiers.erase(identifier);
+    return info;
 
     CO_SIM_IO_CATCH
 }
@@ -276,6 +742,30 @@ void Communication::PostChecks(const Info& I_Info)
     CO_SIM_IO_ERROR_IF_NOT(I_Info.Has("memory_usage_ipc")) << "\"memory_usage_ipc\" must be specified!" << std::endl;
 }
 
+std::vector<int> Communication::GetConnectedPartnerRanks() const
+{
+    CO_SIM_IO_TRY
+
+    std::set<int> partner_ranks(mPartnerRanksAsImporter.begin(), mPartnerRanksAsImporter.end());
+    partner_ranks.insert(mPartnerRanksAsExporter.begin(), mPartnerRanksAsExporter.end());
+    return std::vector<int>(partner_ranks.begin(), partner_ranks.end());
+
+    CO_SIM_IO_CATCH
+}
+
+int Communication::GetPartnerRank(const Info& I_Info) const
+{
+    CO_SIM_IO_TRY
+
+    if (mIsMToNConnection) {
+        return I_Info.Get<int>("partner_rank");
+    }
+
+    return mpDataComm->Rank();
+
+    CO_SIM_IO_CATCH
+}
+
 fs::path Communication::GetTmpFileName(
     const fs::path& rPath,
     const bool UseAuxFileForFileAvailability) const
@@ -331,11 +821,13 @@ void Communication::WaitForPath(
     CO_SIM_IO_TRY
 
     CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>=PrintEchoLevel) << "Waiting for: " << rPath << std::endl;
+    TraceScope trace_scope(GetTracer(), "WaitForPath", "wait", rPath.string());
+    WaitTimer wait_timer;
     if (!UseAuxFileForFileAvailability) {
-        Utilities::WaitUntilPathExists(rPath);
+        Utilities::WaitUntilPathExists(rPath, mFileWaitStrategy);
     } else {
         fs::path avail_file = fs::path(rPath.string()+".avail");
-        Utilities::WaitUntilPathExists(avail_file);
+        Utilities::WaitUntilPathExists(avail_file, mFileWaitStrategy);
 
         // once the file exists it means that the real file was written, hence it can be removed
         RemovePath(avail_file);
@@ -354,9 +846,9 @@ void Communication::WaitUntilFileIsRemoved(
     std::error_code ec;
     if (fs::exists(rPath, ec)) { // only issue the wating message if the file exists initially
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>=PrintEchoLevel) << "Waiting for: " << rPath << " to be removed" << std::endl;
-        while(fs::exists(rPath, ec)) {
-            std::this_thread::sleep_for(std::chrono::microseconds(10)); // wait 0.001s before next check
-        }
+        TraceScope trace_scope(GetTracer(), "WaitUntilFileIsRemoved", "wait", rPath.string());
+        WaitTimer wait_timer;
+        Utilities::WaitUntilPathIsRemoved(rPath, mFileWaitStrategy);
         CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>=PrintEchoLevel) << rPath << " was removed" << std::endl;
     }
 
@@ -407,6 +899,8 @@ void Communication::SynchronizeAll(const std::string& rTag) const
 {
     CO_SIM_IO_TRY
 
+    TraceScope trace_scope(GetTracer(), "SynchronizeAll", "wait", rTag);
+
     // first synchronize among the partitions
     mpDataComm->Barrier();
 
@@ -464,6 +958,7 @@ Info Communication::GetMyInfo() const
 
     my_info.Set<bool>("always_use_serializer", mAlwaysUseSerializer);
     my_info.Set<std::string>("serializer_trace_type", Serializer::TraceTypeToString(mSerializerTraceType));
+    my_info.Set<int>("serializer_trace_format_version", Serializer::GetTraceFormatVersion());
 
     my_info.Set<Info>("communication_settings", GetCommunicationSettings());
 
@@ -474,6 +969,8 @@ void Communication::HandShake(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
+    TraceScope trace_scope(GetTracer(), "HandShake", "connection");
+
     if (mpDataComm->Rank() == 0) {
         const fs::path file_name_p2s(GetFileName("CoSimIO_" + GetConnectionName() + "_compatibility_check_primary_to_secondary", "dat"));
         const fs::path file_name_s2p(GetFileName("CoSimIO_" + GetConnectionName() + "_compatibility_check_secondary_to_primary", "dat"));
@@ -516,12 +1013,17 @@ void Communication::HandShake(const Info& I_Info)
 
         CO_SIM_IO_ERROR_IF(GetCommunicationName() != mPartnerInfo.Get<std::string>("communication_format")) << "Mismatch in communication_format!\nMy communication_format: " << GetCommunicationName() << "\nPartner communication_format: " << mPartnerInfo.Get<std::string>("communication_format") << std::endl;
 
-        CO_SIM_IO_ERROR_IF(GetDataCommunicator().Size() != mPartnerInfo.Get<int>("num_processes")) << "Mismatch in num_processes!\nMy num_processes: " << GetDataCommunicator().Size() << "\nPartner num_processes: " << mPartnerInfo.Get<int>("num_processes") << std::endl;
+        CO_SIM_IO_ERROR_IF(GetDataCommunicator().Size() != mPartnerInfo.Get<int>("num_processes") && !SupportsDifferentNumberOfProcesses()) << "Mismatch in num_processes!\nMy num_processes: " << GetDataCommunicator().Size() << "\nPartner num_processes: " << mPartnerInfo.Get<int>("num_processes") << "\nCommunication format \"" << GetCommunicationName() << "\" (with the current settings) does not support a different number of processes!" << std::endl;
 
         CO_SIM_IO_ERROR_IF(mAlwaysUseSerializer != mPartnerInfo.Get<bool>("always_use_serializer")) << std::boolalpha << "Mismatch in always_use_serializer!\nMy always_use_serializer: " << mAlwaysUseSerializer << "\nPartner always_use_serializer: " << mPartnerInfo.Get<bool>("always_use_serializer") << std::noboolalpha << std::endl;
 
         CO_SIM_IO_ERROR_IF(Serializer::TraceTypeToString(mSerializerTraceType) != mPartnerInfo.Get<std::string>("serializer_trace_type")) << "Mismatch in serializer_trace_type!\nMy serializer_trace_type: " << Serializer::TraceTypeToString(mSerializerTraceType) << "\nPartner serializer_trace_type: " << mPartnerInfo.Get<std::string>("serializer_trace_type") << std::endl;
 
+        // older versions don't send the version of the format of the tags, they write one tag per value
+        const int partner_trace_format_version = mPartnerInfo.Get<int>("serializer_trace_format_version", 1);
+        const bool uses_tags = mSerializerTraceType == Serializer::TraceType::SERIALIZER_TRACE_ERROR || mSerializerTraceType == Serializer::TraceType::SERIALIZER_TRACE_ALL;
+        CO_SIM_IO_ERROR_IF(uses_tags && Serializer::GetTraceFormatVersion() != partner_trace_format_version) << "Mismatch in the format of serializer_trace_type \"" << Serializer::TraceTypeToString(mSerializerTraceType) << "\"!\nMy format version: " << Serializer::GetTraceFormatVersion() << "\nPartner format version: " << partner_trace_format_version << "\nBoth partners have to use the same version of the CoSimIO, or a serializer_trace_type without tags (\"no_trace\" or \"ascii\"), whose format is compatible" << std::endl;
+
         auto print_endianness = [](const bool IsBigEndian){return IsBigEndian ? "big endian" : "small endian";};
 
         CO_SIM_IO_INFO_IF("CoSimIO", Utilities::IsBigEndian() != mPartnerInfo.Get<bool>("is_big_endian")) << "WARNING: Parnters have different endianness, check results carefully! It is recommended to use serialized ascii communication.\n    My endianness:      " << print_endianness(Utilities::IsBigEndian()) << "\n    Partner endianness: " << print_endianness(mPartnerInfo.Get<bool>("is_big_endian")) << std::endl;
@@ -533,6 +1035,16 @@ void Communication::HandShake(const Info& I_Info)
     // sync the partner info among the partitions
     mpDataComm->Broadcast(mPartnerInfo, 0);
 
+    const int partner_num_processes = mPartnerInfo.Get<int>("num_processes");
+    mIsMToNConnection = partner_num_processes != mpDataComm->Size();
+
+    const auto ranks_as_importer = Utilities::ComputePartnerRanksAsImporter(mpDataComm->Rank(), mpDataComm->Size(), partner_num_processes);
+    const auto ranks_as_exporter = Utilities::ComputePartnerRanksAsExporter(mpDataComm->Rank(), mpDataComm->Size(), partner_num_processes);
+    mPartnerRanksAsImporter.assign(ranks_as_importer.begin(), ranks_as_importer.end());
+    mPartnerRanksAsExporter.assign(ranks_as_exporter.begin(), ranks_as_exporter.end());
+
+    CO_SIM_IO_INFO_IF("CoSimIO", mIsMToNConnection && GetEchoLevel()>0 && mpDataComm->Rank() == 0) << "Partner runs with a different number of processes (" << partner_num_processes << " instead of " << mpDataComm->Size() << "), data will be redistributed among the ranks" << std::endl;
+
     CO_SIM_IO_CATCH
 }
 
@@ -543,7 +1055,17 @@ void Communication::PrintElapsedTime(
 {
     const std::string identifier =I_Info.Get<std::string>("identifier");
     const double dur = O_Info.Get<double>("elapsed_time");
-    CO_SIM_IO_INFO_IF("CoSimIO-Timing", GetPrintTiming() && GetDataCommunicator().Rank()==0) << rLabel << " \"" << identifier << "\" took " << dur << " [s]" << std::endl;
+    const double wait = O_Info.Get<double>("elapsed_time_wait", 0.0);
+    CO_SIM_IO_INFO_IF("CoSimIO-Timing", GetPrintTiming() && GetDataCommunicator().Rank()==0) << rLabel << " \"" << identifier << "\" took " << dur << " [s] (waited for " << wait << " [s])" << std::endl;
+}
+
+void Communication::RecordStatistics(
+    const Info& I_Info,
+    const Info& O_Info,
+    const std::string& rOperation,
+    const std::chrono::steady_clock::time_point& rStartTime)
+{
+    mPerformanceStatistics.Record(I_Info.Get<std::string>("identifier"), rOperation, Utilities::ElapsedSeconds(rStartTime), O_Info.Get<double>("elapsed_time_wait"), O_Info);
 }
 
 } // namespace Internals
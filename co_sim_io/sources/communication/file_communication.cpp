@@ -11,13 +11,28 @@
 //
 
 // System includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
+#include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 // Project includes
 #include "includes/communication/file_communication.hpp"
 #include "includes/utilities.hpp"
 #include "includes/file_serializer.hpp"
+#include "includes/stream_serializer.hpp"
+#include "includes/mesh_codec.hpp"
 
 namespace CoSimIO {
 namespace Internals {
@@ -56,14 +71,30 @@ void SerializeFromFile(
 
 }
 
+// placed on its own cache line, the data starts directly afterwards
+// a newly created file is filled with zeros, which is a valid initial state (free, without data)
+struct FileCommunication::MappedFile::Header
+{
+    alignas(64) std::atomic<std::uint64_t> Sequence;
+    std::uint64_t DataSize;
+};
+
 FileCommunication::FileCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
     : Communication(I_Settings, I_DataComm),
       mUseAuxFileForFileAvailability(I_Settings.Get<bool>("use_aux_file_for_file_availability", USE_AUX_FILE_FOR_FILE_AVAILABILITY)),
-      mUseFileSerializer(I_Settings.Get<bool>("use_file_serializer", true))
+      mUseMmap(I_Settings.Get<bool>("use_mmap", false)),
+      mUseFileSerializer(I_Settings.Get<bool>("use_file_serializer", !mUseMmap)),
+      mUseAsyncSend(I_Settings.Get<bool>("use_async_send", false)),
+      mMaxQueuedSends(I_Settings.Get<int>("max_queued_sends", 2))
 {
+    CO_SIM_IO_ERROR_IF(mUseAsyncSend && mMaxQueuedSends < 1) << "\"max_queued_sends\" must be larger than 0!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUseMmap && mUseFileSerializer) << "\"use_mmap\" cannot be combined with \"use_file_serializer\"!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mUseMmap && mUseAsyncSend) << "\"use_mmap\" cannot be combined with \"use_async_send\"!" << std::endl;
+
 #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    CO_SIM_IO_ERROR_IF(mUseMmap) << "\"use_mmap\" is not yet supported in Windows!" << std::endl;
     CO_SIM_IO_INFO_IF("CoSimIO", !mUseAuxFileForFileAvailability) << "WARNING: Using rename for making files available can cause race conditions as it is not atomic in Windows! Use \"use_aux_file_for_file_availability\" = false to avoid this" << std::endl;
 #endif
 }
@@ -81,6 +112,52 @@ FileCommunication::~FileCommunication()
     CO_SIM_IO_CATCH
 }
 
+Info FileCommunication::ConnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (mUseAsyncSend) {
+        mpAsyncFileWriter = CoSimIO::make_unique<AsyncFileWriter>(mMaxQueuedSends);
+    }
+
+    return Info(); // TODO use
+
+    CO_SIM_IO_CATCH
+}
+
+Info FileCommunication::DisconnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    if (mpAsyncFileWriter) {
+        // making sure that all files are written before disconnecting
+        mpAsyncFileWriter->Flush();
+        mpAsyncFileWriter->Stop();
+        mpAsyncFileWriter.reset();
+    }
+
+    if (mUseMmap) {
+        // making sure that the partner is done with all files before removing them
+        SynchronizeAll("file_mmap");
+
+        std::vector<fs::path> owned_files;
+        for (const auto& r_mapped_file : mMappedFiles) {
+            if (r_mapped_file.second->IsOwner()) {
+                owned_files.push_back(r_mapped_file.second->GetPath());
+            }
+        }
+        mMappedFiles.clear();
+
+        for (const auto& r_path : owned_files) {
+            RemovePath(r_path);
+        }
+    }
+
+    return Info(); // TODO use
+
+    CO_SIM_IO_CATCH
+}
+
 void FileCommunication::DerivedHandShake() const
 {
     CO_SIM_IO_TRY
@@ -89,6 +166,10 @@ void FileCommunication::DerivedHandShake() const
     const bool partner_use_aux_file_for_file_availability = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_aux_file_for_file_availability");
     CO_SIM_IO_ERROR_IF(my_use_aux_file_for_file_availability != partner_use_aux_file_for_file_availability) << std::boolalpha << "Mismatch in use_aux_file_for_file_availability!\nMy use_aux_file_for_file_availability: " << my_use_aux_file_for_file_availability << "\nPartner use_aux_file_for_file_availability: " << partner_use_aux_file_for_file_availability << std::noboolalpha << "\nNote that the default on unix is false, while the default on windows is true!"<< std::endl;
 
+    const bool my_use_mmap = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_mmap");
+    const bool partner_use_mmap = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_mmap");
+    CO_SIM_IO_ERROR_IF(my_use_mmap != partner_use_mmap) << std::boolalpha << "Mismatch in use_mmap!\nMy use_mmap: " << my_use_mmap << "\nPartner use_mmap: " << partner_use_mmap << std::noboolalpha << std::endl;
+
     const bool my_use_file_serializer = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_file_serializer");
     const bool partner_use_file_serializer = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_file_serializer");
     CO_SIM_IO_ERROR_IF(my_use_file_serializer != partner_use_file_serializer) << std::boolalpha << "Mismatch in use_file_serializer!\nMy use_file_serializer: " << my_use_file_serializer << "\nPartner use_file_serializer: " << partner_use_file_serializer << std::noboolalpha << std::endl;
@@ -102,6 +183,7 @@ Info FileCommunication::GetCommunicationSettings() const
 
     Info info;
     info.Set("use_aux_file_for_file_availability", mUseAuxFileForFileAvailability);
+    info.Set("use_mmap", mUseMmap);
     info.Set("use_file_serializer", mUseFileSerializer);
 
     return info;
@@ -176,7 +258,8 @@ Info FileCommunication::ImportMeshImpl(
     CO_SIM_IO_TRY
 
     if (mUseFileSerializer) {
-        return GenericReceiveWithFileSerializer(I_Info, O_ModelPart);
+        MeshCodec mesh_codec(O_ModelPart);
+        return GenericReceiveWithFileSerializer(I_Info, mesh_codec);
     }
 
     return Communication::ImportMeshImpl(I_Info, O_ModelPart);
@@ -191,7 +274,7 @@ Info FileCommunication::ExportMeshImpl(
     CO_SIM_IO_TRY
 
     if (mUseFileSerializer) {
-        return GenericSendWithFileSerializer(I_Info, I_ModelPart);
+        return GenericSendWithFileSerializer(I_Info, MeshCodec(I_ModelPart));
     }
 
     return Communication::ExportMeshImpl(I_Info, I_ModelPart);
@@ -210,12 +293,32 @@ Info FileCommunication::GenericSendWithFileSerializer(
 
     const std::string identifier = I_Info.Get<std::string>("identifier");
 
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    const fs::path file_name(GetDataFileName("CoSimIO_data_", identifier, GetPartnerRank(I_Info), true));
 
-    WaitUntilFileIsRemoved(file_name); // TODO maybe this can be queued somehow ... => then it would not block the sender
+    if (mpAsyncFileWriter) {
+        // serializing to memory, the writing of the file is done in the background
+        const auto start_time(std::chrono::steady_clock::now());
+        TraceScope trace_scope(GetTracer(), "serialize", "phase");
+        StreamSerializer serializer(GetSerializerTraceType());
+        serializer.save("obj", rObj);
+        std::shared_ptr<const std::string> p_content = std::make_shared<std::string>(serializer.ExtractStringRepresentation());
+
+        info.Set<std::size_t>("memory_usage_ipc", p_content->size());
+
+        QueueFileForWriting(identifier, file_name, p_content);
+
+        info.Set<double>("elapsed_time", Utilities::ElapsedSeconds(start_time));
+        return info;
+    }
+
+    WaitUntilFileIsRemoved(file_name);
 
     const auto start_time(std::chrono::steady_clock::now());
-    SerializeToFile(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), rObj, GetSerializerTraceType());
+    {
+        // the object is serialized directly to the file
+        TraceScope trace_scope(GetTracer(), "serialize", "phase");
+        SerializeToFile(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), rObj, GetSerializerTraceType());
+    }
 
     info.Set<std::size_t>("memory_usage_ipc", fs::file_size(GetTmpFileName(file_name, mUseAuxFileForFileAvailability)));
 
@@ -239,14 +342,17 @@ Info FileCommunication::GenericReceiveWithFileSerializer(
 
     const std::string identifier = I_Info.Get<std::string>("identifier");
 
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    const fs::path file_name(GetDataFileName("CoSimIO_data_", identifier, GetPartnerRank(I_Info), false));
 
     WaitForPath(file_name, mUseAuxFileForFileAvailability);
 
     info.Set<std::size_t>("memory_usage_ipc", fs::file_size(file_name));
 
     const auto start_time(std::chrono::steady_clock::now());
-    SerializeFromFile(file_name, rObj, GetSerializerTraceType());
+    {
+        TraceScope trace_scope(GetTracer(), "deserialize", "phase");
+        SerializeFromFile(file_name, rObj, GetSerializerTraceType());
+    }
 
     RemovePath(file_name);
 
@@ -267,12 +373,38 @@ double FileCommunication::GenericSend(
 
     const std::string identifier = I_Info.Get<std::string>("identifier");
 
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
-
-    WaitUntilFileIsRemoved(file_name); // TODO maybe this can be queued somehow ... => then it would not block the sender
+    const fs::path file_name(GetDataFileName("CoSimIO_data_", identifier, GetPartnerRank(I_Info), true));
 
     const std::size_t size = rData.size();
 
+    if (mUseMmap) {
+        MappedFile& r_mapped_file = GetMappedFile(GetDataFileName("CoSimIO_mmap_", identifier, GetPartnerRank(I_Info), true));
+        {
+            WaitTimer wait_timer;
+            r_mapped_file.WaitUntilFree();
+        }
+
+        const auto start_time(std::chrono::steady_clock::now());
+        r_mapped_file.Write(reinterpret_cast<const char*>(rData.data()), size*SizeOfData);
+        return Utilities::ElapsedSeconds(start_time);
+    }
+
+    if (mpAsyncFileWriter) {
+        // copying the data to a buffer (with the same layout as the file), the writing of the file is done in the background
+        const auto start_time(std::chrono::steady_clock::now());
+        std::shared_ptr<std::string> p_content = std::make_shared<std::string>(sizeof(std::size_t) + size*SizeOfData, '\0');
+        std::memcpy(&(*p_content)[0], &size, sizeof(std::size_t));
+        if (size > 0) {
+            std::memcpy(&(*p_content)[sizeof(std::size_t)], &rData[0], size*SizeOfData);
+        }
+
+        QueueFileForWriting(identifier, file_name, p_content);
+
+        return Utilities::ElapsedSeconds(start_time);
+    }
+
+    WaitUntilFileIsRemoved(file_name);
+
     const auto start_time(std::chrono::steady_clock::now());
 
     std::ofstream output_file(GetTmpFileName(file_name, mUseAuxFileForFileAvailability), std::ios::out|std::ios::binary);
@@ -300,7 +432,24 @@ double FileCommunication::GenericReceive(
 
     const std::string identifier = I_Info.Get<std::string>("identifier");
 
-    const fs::path file_name(GetFileName("CoSimIO_data_" + GetConnectionName() + "_" + identifier + "_" + std::to_string(GetDataCommunicator().Rank()), "dat"));
+    if (mUseMmap) {
+        MappedFile& r_mapped_file = GetMappedFile(GetDataFileName("CoSimIO_mmap_", identifier, GetPartnerRank(I_Info), false));
+        std::size_t size_read;
+        {
+            WaitTimer wait_timer;
+            size_read = r_mapped_file.WaitForData();
+        }
+
+        const auto start_time(std::chrono::steady_clock::now());
+        rData.resize(size_read/SizeOfData);
+        if (size_read > 0) {
+            std::memcpy(&rData[0], r_mapped_file.GetData(), size_read);
+        }
+        r_mapped_file.Release();
+        return Utilities::ElapsedSeconds(start_time);
+    }
+
+    const fs::path file_name(GetDataFileName("CoSimIO_data_", identifier, GetPartnerRank(I_Info), false));
 
     WaitForPath(file_name, mUseAuxFileForFileAvailability);
 
@@ -323,6 +472,57 @@ double FileCommunication::GenericReceive(
     CO_SIM_IO_CATCH
 }
 
+fs::path FileCommunication::GetDataFileName(
+    const std::string& rPrefix,
+    const std::string& rIdentifier,
+    const int PartnerRank,
+    const bool IsSending) const
+{
+    // the files are unique for each direction and pair of ranks, as with a different number of processes a rank can exchange data with several partner ranks
+    const bool primary_is_sending = IsSending == GetIsPrimaryConnection();
+    const int sending_rank = IsSending ? GetDataCommunicator().Rank() : PartnerRank;
+    const int receiving_rank = IsSending ? PartnerRank : GetDataCommunicator().Rank();
+
+    return GetFileName(rPrefix + GetConnectionName() + "_" + rIdentifier + (primary_is_sending ? "_p" : "_s") + std::to_string(sending_rank) + "_" + std::to_string(receiving_rank), "dat");
+}
+
+FileCommunication::MappedFile& FileCommunication::GetMappedFile(const fs::path& rFileName)
+{
+    CO_SIM_IO_TRY
+
+    std::lock_guard<std::mutex> lock(mMappedFilesMutex);
+
+    auto it_mapped_file = mMappedFiles.find(rFileName.string());
+    if (it_mapped_file == mMappedFiles.end()) {
+        it_mapped_file = mMappedFiles.emplace(rFileName.string(), CoSimIO::make_unique<MappedFile>(rFileName)).first;
+    }
+
+    return *(it_mapped_file->second);
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::QueueFileForWriting(
+    const std::string& rIdentifier,
+    const fs::path& rFileName,
+    std::shared_ptr<const std::string> pContent)
+{
+    CO_SIM_IO_TRY
+
+    const bool use_aux_file = mUseAuxFileForFileAvailability;
+
+    mpAsyncFileWriter->Push(rIdentifier, rFileName, [this, rFileName, pContent, use_aux_file](){
+        const fs::path tmp_file_name = GetTmpFileName(rFileName, use_aux_file);
+        std::ofstream output_file(tmp_file_name, std::ios::out|std::ios::binary);
+        Utilities::CheckStream(output_file, tmp_file_name);
+        output_file.write(pContent->data(), pContent->size());
+        output_file.close();
+        MakeFileVisible(rFileName, use_aux_file);
+    });
+
+    CO_SIM_IO_CATCH
+}
+
 double FileCommunication::SendString(
     const Info& I_Info,
     const std::string& rData)
@@ -351,5 +551,292 @@ double FileCommunication::ReceiveDataContainer(
     return GenericReceive(I_Info, rData, sizeof(double));
 }
 
+FileCommunication::MappedFile::MappedFile(const fs::path& rPath)
+    : mPath(rPath)
+{
+    CO_SIM_IO_TRY
+
+    #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    CO_SIM_IO_ERROR << "Memory mapped files are not yet implemented for Windows!" << std::endl;
+    #else
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Memory mapped files require lock-free 64-bit atomics!");
+
+    // the file is first created with a temporary name and then linked to the final name, which fails if the partner was faster
+    // this way the file always has at least the size of the header when it is opened
+    const fs::path tmp_path(mPath.string() + "." + std::to_string(getpid()) + "_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".tmp");
+
+    const int file_descriptor = open(tmp_path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    CO_SIM_IO_ERROR_IF(file_descriptor < 0) << tmp_path << " could not be created: " << std::strerror(errno) << std::endl;
+    fchmod(file_descriptor, 0666); // otherwise the process with lower rights cannot open it
+
+    if (ftruncate(file_descriptor, sizeof(Header)) != 0) {
+        close(file_descriptor);
+        unlink(tmp_path.c_str());
+        CO_SIM_IO_ERROR << tmp_path << " could not be resized: " << std::strerror(errno) << std::endl;
+    }
+
+    if (link(tmp_path.c_str(), mPath.c_str()) == 0) {
+        mIsOwner = true;
+        mFileDescriptor = file_descriptor;
+    } else {
+        const int link_error = errno;
+        close(file_descriptor);
+        unlink(tmp_path.c_str());
+        CO_SIM_IO_ERROR_IF(link_error != EEXIST) << mPath << " could not be created: " << std::strerror(link_error) << std::endl;
+
+        mFileDescriptor = open(mPath.c_str(), O_RDWR);
+        CO_SIM_IO_ERROR_IF(mFileDescriptor < 0) << mPath << " could not be opened: " << std::strerror(errno) << std::endl;
+    }
+    unlink(tmp_path.c_str());
+
+    struct stat file_stat;
+    CO_SIM_IO_ERROR_IF(fstat(mFileDescriptor, &file_stat) != 0) << "Size of " << mPath << " could not be determined!" << std::endl;
+    Map(static_cast<std::size_t>(file_stat.st_size));
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+FileCommunication::MappedFile::~MappedFile()
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    if (mpMapped) {
+        munmap(mpMapped, mMappedSize);
+    }
+    if (mFileDescriptor >= 0) {
+        close(mFileDescriptor);
+    }
+    #endif
+}
+
+void FileCommunication::MappedFile::WaitUntilFree()
+{
+    Utilities::WaitUntil([this](){return GetHeader().Sequence.load(std::memory_order_acquire) % 2 == 0;});
+}
+
+void FileCommunication::MappedFile::Write(const char* pData, const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    const std::uint64_t sequence = GetHeader().Sequence.load(std::memory_order_acquire);
+    CO_SIM_IO_ERROR_IF(sequence % 2 != 0) << mPath << " still contains data that was not read!" << std::endl;
+
+    Resize(sizeof(Header) + Size);
+
+    if (Size > 0) {
+        std::memcpy(mpMapped + sizeof(Header), pData, Size);
+    }
+    GetHeader().DataSize = Size;
+    GetHeader().Sequence.store(sequence+1, std::memory_order_release);
+
+    CO_SIM_IO_CATCH
+}
+
+std::size_t FileCommunication::MappedFile::WaitForData()
+{
+    CO_SIM_IO_TRY
+
+    Utilities::WaitUntil([this](){return GetHeader().Sequence.load(std::memory_order_acquire) % 2 != 0;});
+
+    const std::size_t size = GetHeader().DataSize;
+    Resize(sizeof(Header) + size); // the partner might have increased the size of the file
+
+    return size;
+
+    CO_SIM_IO_CATCH
+}
+
+const char* FileCommunication::MappedFile::GetData() const
+{
+    return mpMapped + sizeof(Header);
+}
+
+void FileCommunication::MappedFile::Release()
+{
+    const std::uint64_t sequence = GetHeader().Sequence.load(std::memory_order_relaxed);
+    GetHeader().Sequence.store(sequence+1, std::memory_order_release);
+}
+
+FileCommunication::MappedFile::Header& FileCommunication::MappedFile::GetHeader() const
+{
+    return *reinterpret_cast<Header*>(mpMapped);
+}
+
+void FileCommunication::MappedFile::Resize(const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    if (Size <= mMappedSize) {
+        return;
+    }
+
+    // the file is only growing, hence the data is never truncated
+    struct stat file_stat;
+    CO_SIM_IO_ERROR_IF(fstat(mFileDescriptor, &file_stat) != 0) << "Size of " << mPath << " could not be determined!" << std::endl;
+    if (static_cast<std::size_t>(file_stat.st_size) < Size) {
+        CO_SIM_IO_ERROR_IF(ftruncate(mFileDescriptor, Size) != 0) << mPath << " could not be resized to " << Size << " bytes: " << std::strerror(errno) << std::endl;
+    }
+
+    Map(Size);
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::MappedFile::Map(const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    if (mpMapped) {
+        munmap(mpMapped, mMappedSize);
+        mpMapped = nullptr;
+    }
+
+    void* p_mapped = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, mFileDescriptor, 0);
+    CO_SIM_IO_ERROR_IF(p_mapped == MAP_FAILED) << mPath << " could not be mapped: " << std::strerror(errno) << std::endl;
+
+    mpMapped = static_cast<char*>(p_mapped);
+    mMappedSize = Size;
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+FileCommunication::AsyncFileWriter::AsyncFileWriter(const std::size_t MaxQueueSize)
+    : mMaxQueueSize(MaxQueueSize)
+{
+    mThread = std::thread(&AsyncFileWriter::Run, this);
+}
+
+FileCommunication::AsyncFileWriter::~AsyncFileWriter()
+{
+    if (mThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        mThread.join();
+    }
+}
+
+void FileCommunication::AsyncFileWriter::Push(
+    const std::string& rIdentifier,
+    const fs::path& rFileName,
+    WriteFunctionType WriteFunction)
+{
+    CO_SIM_IO_TRY
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    std::deque<Job>& r_queue = mQueues[rIdentifier];
+    mCondition.wait(lock, [this, &r_queue](){return r_queue.size() < mMaxQueueSize || mpException;});
+    ThrowIfFailed();
+
+    r_queue.push_back(Job{rFileName, std::move(WriteFunction)});
+    ++mNumPendingJobs;
+
+    lock.unlock();
+    mCondition.notify_all();
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::AsyncFileWriter::Flush()
+{
+    CO_SIM_IO_TRY
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this](){return mNumPendingJobs == 0 || mpException;});
+    ThrowIfFailed();
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::AsyncFileWriter::Stop()
+{
+    CO_SIM_IO_TRY
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+
+    CO_SIM_IO_CATCH
+}
+
+void FileCommunication::AsyncFileWriter::Run()
+{
+    // the time for waiting is increased if none of the files can be written
+    // it is reset once there is progress or new files are queued
+    const std::chrono::microseconds min_wait_time(10);
+    const std::chrono::microseconds max_wait_time(10000);
+    std::chrono::microseconds wait_time(min_wait_time);
+
+    while (true) {
+        std::vector<std::pair<std::string, fs::path>> next_files;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this](){return mStop || (mNumPendingJobs > 0 && !mpException);});
+            if (mStop && (mNumPendingJobs == 0 || mpException)) {
+                return;
+            }
+
+            for (const auto& r_queue : mQueues) {
+                if (!r_queue.second.empty()) {
+                    next_files.push_back(std::make_pair(r_queue.first, r_queue.second.front().FileName));
+                }
+            }
+        }
+
+        bool progress = false;
+        for (const auto& r_next_file : next_files) {
+            // the previous file of this identifier was not yet read by the partner
+            std::error_code ec;
+            if (fs::exists(r_next_file.second, ec)) {continue;}
+
+            Job* p_job;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                p_job = &mQueues[r_next_file.first].front(); // references to elements of a deque stay valid when pushing
+            }
+
+            try {
+                p_job->Write();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mpException = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mQueues[r_next_file.first].pop_front();
+                --mNumPendingJobs;
+            }
+            mCondition.notify_all();
+            progress = true;
+        }
+
+        if (progress) {
+            wait_time = min_wait_time;
+        } else {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait_for(lock, wait_time);
+            wait_time = std::min(2*wait_time, max_wait_time);
+        }
+    }
+}
+
+void FileCommunication::AsyncFileWriter::ThrowIfFailed()
+{
+    if (mpException) {
+        std::rethrow_exception(mpException);
+    }
+}
+
 } // namespace Internals
 } // namespace CoSimIO
@@ -0,0 +1,147 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <algorithm>
+#include <cmath>
+
+// Project includes
+#include "includes/communication/performance_statistics.hpp"
+#include "includes/communication/tracer.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+double& AccumulatedWaitTime()
+{
+    static thread_local double accumulated_wait_time = 0.0;
+    return accumulated_wait_time;
+}
+
+}
+
+constexpr std::size_t PerformanceStatistics::NumberOfHistogramBins;
+
+void PerformanceStatistics::Record(
+    const std::string& rIdentifier,
+    const std::string& rOperation,
+    const double ElapsedTime,
+    const double WaitTime,
+    const Info& O_Info)
+{
+    CO_SIM_IO_TRY
+
+    const double serialize_time = O_Info.Get<double>("elapsed_time_serializer", 0.0);
+    const double transfer_time = O_Info.Has("elapsed_time_ipc") ? O_Info.Get<double>("elapsed_time_ipc") : O_Info.Get<double>("elapsed_time") - serialize_time;
+
+    OperationStatistics& r_stats = mStatistics[rIdentifier][rOperation];
+
+    ++r_stats.Count;
+    r_stats.Bytes += static_cast<double>(O_Info.Get<std::size_t>("memory_usage_ipc", 0));
+    r_stats.Time.Add(ElapsedTime);
+    r_stats.Wait.Add(WaitTime);
+    r_stats.Serialize.Add(serialize_time);
+    r_stats.Transfer.Add(std::max(transfer_time, 0.0));
+
+    CO_SIM_IO_CATCH
+}
+
+Info PerformanceStatistics::GetInfo() const
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+
+    for (const auto& r_identifier_stats : mStatistics) {
+        Info identifier_info;
+        for (const auto& r_operation_stats : r_identifier_stats.second) {
+            const OperationStatistics& r_stats = r_operation_stats.second;
+            Info operation_info;
+            operation_info.Set<int>("count", r_stats.Count);
+            operation_info.Set<double>("bytes", r_stats.Bytes);
+            operation_info.Set<Info>("time", r_stats.Time.GetInfo());
+            operation_info.Set<Info>("wait", r_stats.Wait.GetInfo());
+            operation_info.Set<Info>("serialize", r_stats.Serialize.GetInfo());
+            operation_info.Set<Info>("transfer", r_stats.Transfer.GetInfo());
+            identifier_info.Set<Info>(r_operation_stats.first, operation_info);
+        }
+        info.Set<Info>(r_identifier_stats.first, identifier_info);
+    }
+
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+void PerformanceStatistics::Reset()
+{
+    mStatistics.clear();
+}
+
+void PerformanceStatistics::TimeStatistics::Add(const double Time)
+{
+    mTotal += Time;
+    mMin = mIsEmpty ? Time : std::min(mMin, Time);
+    mMax = mIsEmpty ? Time : std::max(mMax, Time);
+    mIsEmpty = false;
+
+    const double time_in_microseconds = Time*1e6;
+    std::size_t bin = 0;
+    if (time_in_microseconds >= 1.0) {
+        bin = std::min(static_cast<std::size_t>(std::log2(time_in_microseconds))+1, NumberOfHistogramBins-1);
+    }
+    ++mHistogram[bin];
+}
+
+Info PerformanceStatistics::TimeStatistics::GetInfo() const
+{
+    Info info;
+    info.Set<double>("total", mTotal);
+    info.Set<double>("min", mMin);
+    info.Set<double>("max", mMax);
+
+    Info histogram;
+    for (std::size_t i=0; i<NumberOfHistogramBins; ++i) {
+        histogram.Set<int>("bin_"+std::to_string(i), mHistogram[i]);
+    }
+    info.Set<Info>("histogram", histogram);
+
+    return info;
+}
+
+WaitTimer::~WaitTimer()
+{
+    const auto end_time(std::chrono::steady_clock::now());
+    AccumulatedWaitTime() += std::chrono::duration<double>(end_time - mStartTime).count();
+
+    Tracer* p_tracer = Tracer::GetActive();
+    if (p_tracer) {
+        p_tracer->AddEvent("wait", "phase", "", mStartTime, end_time);
+    }
+}
+
+double WaitTimer::GetAccumulatedTime()
+{
+    return AccumulatedWaitTime();
+}
+
+double WaitTimer::ExtractAccumulatedTime()
+{
+    const double accumulated_wait_time = AccumulatedWaitTime();
+    AccumulatedWaitTime() = 0.0;
+    return accumulated_wait_time;
+}
+
+} // namespace Internals
+} // namespace CoSimIO
@@ -11,6 +11,7 @@
 //
 
 // System includes
+#include <algorithm>
 #include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
 
 #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
@@ -20,6 +21,13 @@
     #include <sys/stat.h>
     #include <sys/types.h>
     #include <unistd.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    #include <sys/uio.h>
+    #include <fstream>
 #endif
 
 // External includes
@@ -45,14 +53,76 @@ int GetPipeBufferSize(const Info& I_Info)
     return I_Info.Get<int>("buffer_size", default_buffer_size);
 }
 
+// largest size of a pipe that can be set without privileges
+int GetMaxPipeSize()
+{
+    int max_pipe_size = 0;
+
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    std::ifstream max_pipe_size_file("/proc/sys/fs/pipe-max-size");
+    max_pipe_size_file >> max_pipe_size;
+    #endif
+
+    return max_pipe_size;
+}
+
+constexpr std::uint64_t ACK_REQUESTED_FLAG = std::uint64_t(1) << 63;
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+// write and read can transfer less than requested (e.g. when the pipe is full or empty)
+// or be interrupted by a signal before anything was transferred, in both cases they are called again
+void WriteToPipe(
+    const int PipeHandle,
+    const char* pData,
+    const std::size_t SizeBytes,
+    const std::size_t ChunkSize)
+{
+    std::size_t written_size_bytes=0;
+
+    while(written_size_bytes<SizeBytes) {
+        const std::size_t current_chunk_size = std::min(SizeBytes-written_size_bytes, ChunkSize);
+
+        const ssize_t bytes_written = write(PipeHandle, pData + written_size_bytes, current_chunk_size);
+        if (bytes_written < 0 && errno == EINTR) {continue;}
+        CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe: " << std::strerror(errno) << std::endl;
+
+        written_size_bytes += bytes_written;
+    }
+}
+
+void ReadFromPipe(
+    const int PipeHandle,
+    char* pData,
+    const std::size_t SizeBytes,
+    const std::size_t ChunkSize)
+{
+    std::size_t read_size_bytes=0;
+
+    while(read_size_bytes<SizeBytes) {
+        const std::size_t current_chunk_size = std::min(SizeBytes-read_size_bytes, ChunkSize);
+
+        const ssize_t bytes_read = read(PipeHandle, pData + read_size_bytes, current_chunk_size);
+        if (bytes_read < 0 && errno == EINTR) {continue;}
+        CO_SIM_IO_ERROR_IF(bytes_read < 0) << "Error in reading from Pipe: " << std::strerror(errno) << std::endl;
+        CO_SIM_IO_ERROR_IF(bytes_read == 0) << "Pipe was closed by the partner!" << std::endl;
+
+        read_size_bytes += bytes_read;
+    }
+}
+#endif
+
 } // anonymous namespace
 
 PipeCommunication::PipeCommunication(
     const Info& I_Settings,
     std::shared_ptr<DataCommunicator> I_DataComm)
     : Communication(I_Settings, I_DataComm),
-      mBufferSize(GetPipeBufferSize(I_Settings))
+      mBufferSize(GetPipeBufferSize(I_Settings)),
+      mUseVmsplice(I_Settings.Get<bool>("use_vmsplice", false))
 {
+    #ifndef CO_SIM_IO_COMPILED_IN_LINUX
+    CO_SIM_IO_ERROR_IF(mUseVmsplice) << "\"use_vmsplice\" is only available on Linux!" << std::endl;
+    #endif
 }
 
 PipeCommunication::~PipeCommunication()
@@ -75,6 +145,7 @@ Info PipeCommunication::ConnectDetail(const Info& I_Info)
         GetConnectionName() + "_r" + std::to_string(GetDataCommunicator().Rank()),
         GetIsPrimaryConnection(),
         GetPipeBufferSize(I_Info),
+        mUseVmsplice,
         GetEchoLevel());
 
     return Info(); // TODO use
@@ -95,6 +166,10 @@ void PipeCommunication::DerivedHandShake() const
     const std::size_t my_use_buffer_size = GetMyInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
     const std::size_t partner_buffer_size = GetPartnerInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
     CO_SIM_IO_ERROR_IF(my_use_buffer_size != partner_buffer_size) << "Mismatch in buffer_size!\nMy buffer_size: " << my_use_buffer_size << "\nPartner buffer_size: " << partner_buffer_size << std::noboolalpha << std::endl;
+
+    const bool my_use_vmsplice = GetMyInfo().Get<Info>("communication_settings").Get<bool>("use_vmsplice");
+    const bool partner_use_vmsplice = GetPartnerInfo().Get<Info>("communication_settings").Get<bool>("use_vmsplice");
+    CO_SIM_IO_ERROR_IF(my_use_vmsplice != partner_use_vmsplice) << std::boolalpha << "Mismatch in use_vmsplice!\nMy use_vmsplice: " << my_use_vmsplice << "\nPartner use_vmsplice: " << partner_use_vmsplice << std::noboolalpha << std::endl;
 }
 
 Info PipeCommunication::GetCommunicationSettings() const
@@ -103,6 +178,7 @@ Info PipeCommunication::GetCommunicationSettings() const
 
     Info info;
     info.Set("buffer_size", mBufferSize);
+    info.Set("use_vmsplice", mUseVmsplice);
     return info;
 
     CO_SIM_IO_CATCH
@@ -114,9 +190,14 @@ PipeCommunication::BidirectionalPipe::BidirectionalPipe(
     const fs::path& rBasePipeName,
     const bool IsPrimary,
     const int BufferSize,
+    const bool UseVmsplice,
     const int EchoLevel) 
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-    : mBufferSize(BufferSize)
+    : mChunkSizeWrite(BufferSize),
+      mChunkSizeRead(BufferSize),
+      mUseVmsplice(UseVmsplice)
+    #else
+    : mUseVmsplice(UseVmsplice)
     #endif
 {
     mPipeNameWrite = mPipeNameRead = rPipeDir / rBasePipeName;
@@ -129,9 +210,17 @@ PipeCommunication::BidirectionalPipe::BidirectionalPipe(
         mPipeNameRead  += "_s2p";
 
         CO_SIM_IO_ERROR_IF(mkfifo(mPipeNameWrite.c_str(), 0666) != 0) << "Pipe " << mPipeNameWrite << " could not be created!" << std::endl;
+        if (mUseVmsplice) {
+            CO_SIM_IO_ERROR_IF(mkfifo((mPipeNameWrite.string()+"_ack").c_str(), 0666) != 0) << "Pipe " << mPipeNameWrite << "_ack could not be created!" << std::endl;
+            CO_SIM_IO_ERROR_IF(mkfifo((mPipeNameRead.string()+"_ack").c_str(), 0666) != 0) << "Pipe " << mPipeNameRead << "_ack could not be created!" << std::endl;
+        }
         CO_SIM_IO_ERROR_IF(mkfifo(mPipeNameRead.c_str(), 0666) != 0) << "Pipe " << mPipeNameRead << " could not be created!" << std::endl;
         CO_SIM_IO_ERROR_IF((mPipeHandleWrite = open(mPipeNameWrite.c_str(), O_WRONLY)) < 0) << "Pipe " << mPipeNameWrite << " could not be opened!" << std::endl;
         CO_SIM_IO_ERROR_IF((mPipeHandleRead = open(mPipeNameRead.c_str(), O_RDONLY)) < 0) << "Pipe " << mPipeNameRead << " could not be opened!" << std::endl;
+        if (mUseVmsplice) {
+            CO_SIM_IO_ERROR_IF((mPipeHandleAckRead = open((mPipeNameWrite.string()+"_ack").c_str(), O_RDONLY)) < 0) << "Pipe " << mPipeNameWrite << "_ack could not be opened!" << std::endl;
+            CO_SIM_IO_ERROR_IF((mPipeHandleAckWrite = open((mPipeNameRead.string()+"_ack").c_str(), O_WRONLY)) < 0) << "Pipe " << mPipeNameRead << "_ack could not be opened!" << std::endl;
+        }
 
     } else {
         mPipeNameWrite += "_s2p";
@@ -141,33 +230,41 @@ PipeCommunication::BidirectionalPipe::BidirectionalPipe(
 
         CO_SIM_IO_ERROR_IF((mPipeHandleRead = open(mPipeNameRead.c_str(), O_RDONLY)) < 0) << "Pipe " << mPipeNameRead << " could not be opened!" << std::endl;
         CO_SIM_IO_ERROR_IF((mPipeHandleWrite = open(mPipeNameWrite.c_str(), O_WRONLY)) < 0) << "Pipe " << mPipeNameWrite << " could not be opened!" << std::endl;
+        if (mUseVmsplice) {
+            CO_SIM_IO_ERROR_IF((mPipeHandleAckWrite = open((mPipeNameRead.string()+"_ack").c_str(), O_WRONLY)) < 0) << "Pipe " << mPipeNameRead << "_ack could not be opened!" << std::endl;
+            CO_SIM_IO_ERROR_IF((mPipeHandleAckRead = open((mPipeNameWrite.string()+"_ack").c_str(), O_RDONLY)) < 0) << "Pipe " << mPipeNameWrite << "_ack could not be opened!" << std::endl;
+        }
     }
 
     // if possible try to resize the pipes to the buffer size
     // not resizing still works but leads to communication in more chunks
+    // with vmsplice the pipes are made as large as allowed, such that more pages of the data are mapped at once
     #if defined(F_GETPIPE_SZ) && defined(F_SETPIPE_SZ) // some old kernels don't define this
+    const int pipe_size = mUseVmsplice ? std::max(BufferSize, GetMaxPipeSize()) : BufferSize;
+
     const int pipe_buffer_size_read = fcntl(mPipeHandleRead, F_GETPIPE_SZ);
     const int pipe_buffer_size_write = fcntl(mPipeHandleWrite, F_GETPIPE_SZ);
 
     const int max_pipe_buffer = std::max(pipe_buffer_size_read, pipe_buffer_size_write);
-    if (pipe_buffer_size_read  < max_pipe_buffer) {fcntl(mPipeHandleRead,  F_SETPIPE_SZ, BufferSize);}
-    if (pipe_buffer_size_write < max_pipe_buffer) {fcntl(mPipeHandleWrite, F_SETPIPE_SZ, BufferSize);}
+    if (pipe_buffer_size_read  < max_pipe_buffer) {fcntl(mPipeHandleRead,  F_SETPIPE_SZ, pipe_size);}
+    if (pipe_buffer_size_write < max_pipe_buffer) {fcntl(mPipeHandleWrite, F_SETPIPE_SZ, pipe_size);}
 
-    if (BufferSize > max_pipe_buffer) {
-        CO_SIM_IO_INFO_IF("CoSimIO", EchoLevel>0) << "Requested buffer size (" << BufferSize << ") is larger than pipe buffer size (" << max_pipe_buffer << "). Attempting to increase size of pipe buffer" << std::endl;
-        fcntl(mPipeHandleRead,  F_SETPIPE_SZ, BufferSize);
-        fcntl(mPipeHandleWrite, F_SETPIPE_SZ, BufferSize);
+    if (pipe_size > max_pipe_buffer) {
+        CO_SIM_IO_INFO_IF("CoSimIO", EchoLevel>0) << "Requested buffer size (" << pipe_size << ") is larger than pipe buffer size (" << max_pipe_buffer << "). Attempting to increase size of pipe buffer" << std::endl;
+        fcntl(mPipeHandleRead,  F_SETPIPE_SZ, pipe_size);
+        fcntl(mPipeHandleWrite, F_SETPIPE_SZ, pipe_size);
 
         const int new_pipe_buffer_size = fcntl(mPipeHandleRead, F_GETPIPE_SZ);
         CO_SIM_IO_ERROR_IF(new_pipe_buffer_size != fcntl(mPipeHandleWrite, F_GETPIPE_SZ)) << "Different buffer sizes after changing size, this should not happen!" << std::endl;
 
         // not comparing equal, as pipe buffer size is multiple of getpagesize()
-        CO_SIM_IO_INFO_IF("CoSimIO", new_pipe_buffer_size == BufferSize && EchoLevel>0) << "Resizing pipe buffer was successful! Pipe buffer size is now " << new_pipe_buffer_size << std::endl;
-        CO_SIM_IO_INFO_IF("CoSimIO", new_pipe_buffer_size < BufferSize) << "Resizing pipe buffer was not successful! Pipe buffer size is " << new_pipe_buffer_size << " even though " << BufferSize << " was requested!" << std::endl;
+        CO_SIM_IO_INFO_IF("CoSimIO", new_pipe_buffer_size == pipe_size && EchoLevel>0) << "Resizing pipe buffer was successful! Pipe buffer size is now " << new_pipe_buffer_size << std::endl;
+        CO_SIM_IO_INFO_IF("CoSimIO", new_pipe_buffer_size < pipe_size) << "Resizing pipe buffer was not successful! Pipe buffer size is " << new_pipe_buffer_size << " even though " << pipe_size << " was requested!" << std::endl;
     }
 
-    const int final_pipe_buffer_size = fcntl(mPipeHandleRead, F_GETPIPE_SZ);
-    if (BufferSize >= final_pipe_buffer_size) {mBufferSize = final_pipe_buffer_size-1;} // crashes if same size or larger!
+    // the partial transfers are handled, hence the chunks can be as large as the pipes
+    mChunkSizeWrite = fcntl(mPipeHandleWrite, F_GETPIPE_SZ);
+    mChunkSizeRead = fcntl(mPipeHandleRead, F_GETPIPE_SZ);
     #endif
 
     #endif
@@ -178,29 +275,96 @@ void PipeCommunication::BidirectionalPipe::Close()
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
     close(mPipeHandleWrite);
     close(mPipeHandleRead);
+    if (mUseVmsplice) {
+        close(mPipeHandleAckWrite);
+        close(mPipeHandleAckRead);
+    }
     #endif
 }
 
-void PipeCommunication::BidirectionalPipe::SendSize(const std::uint64_t Size)
+void PipeCommunication::BidirectionalPipe::SendSize(const std::uint64_t Size, const bool RequestAck)
 {
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
-    const ssize_t bytes_written = write(mPipeHandleWrite, &Size, sizeof(Size));
-    CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe!" << std::endl;
+    WaitTimer wait_timer; // blocks if the partner did not yet read the previous message
+    const std::uint64_t header = RequestAck ? (Size | ACK_REQUESTED_FLAG) : Size;
+    WriteToPipe(mPipeHandleWrite, reinterpret_cast<const char*>(&header), sizeof(header), sizeof(header));
     #endif
 }
 
-std::uint64_t PipeCommunication::BidirectionalPipe::ReceiveSize()
+std::uint64_t PipeCommunication::BidirectionalPipe::ReceiveSize(bool& rAckRequested)
 {
     #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    WaitTimer wait_timer; // blocks until the partner sends
     std::uint64_t imp_size_u;
-    const ssize_t bytes_read = read(mPipeHandleRead, &imp_size_u, sizeof(imp_size_u));
-    CO_SIM_IO_ERROR_IF(bytes_read < 0) << "Error in reading from Pipe!" << std::endl;
-    return imp_size_u;
+    ReadFromPipe(mPipeHandleRead, reinterpret_cast<char*>(&imp_size_u), sizeof(imp_size_u), sizeof(imp_size_u));
+    rAckRequested = (imp_size_u & ACK_REQUESTED_FLAG) != 0;
+    return imp_size_u & ~ACK_REQUESTED_FLAG;
     #else
+    rAckRequested = false;
     return 0;
     #endif
 }
 
+bool PipeCommunication::BidirectionalPipe::UseVmspliceForSize(const std::size_t SizeBytes) const
+{
+    #if defined(CO_SIM_IO_COMPILED_IN_LINUX) && defined(F_GETPIPE_SZ)
+    // queried every time, as the partner might still be resizing the pipe when the first data is written
+    return mUseVmsplice && SizeBytes > static_cast<std::size_t>(fcntl(mPipeHandleWrite, F_GETPIPE_SZ));
+    #else
+    return false;
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::WriteVmsplice(const char* pData, const std::size_t SizeBytes)
+{
+    CO_SIM_IO_TRY
+
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    std::size_t written_size_bytes=0;
+
+    // the pipe might accept less than requested, hence continuing from what was actually written
+    while(written_size_bytes<SizeBytes) {
+        struct iovec data_pages;
+        data_pages.iov_base = const_cast<char*>(pData) + written_size_bytes; // the data is not modified by vmsplice
+        data_pages.iov_len = SizeBytes - written_size_bytes;
+
+        const ssize_t bytes_written = vmsplice(mPipeHandleWrite, &data_pages, 1, 0);
+        if (bytes_written < 0 && errno == EINTR) {continue;}
+        CO_SIM_IO_ERROR_IF(bytes_written < 0) << "Error in writing to Pipe with vmsplice: " << std::strerror(errno) << std::endl;
+
+        written_size_bytes += bytes_written;
+    }
+
+    // the pipe references the pages of the data until they are read, hence the data must not be modified before
+    char ack;
+    ReadFromPipe(mPipeHandleAckRead, &ack, 1, 1);
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void PipeCommunication::BidirectionalPipe::WriteBytes(const char* pData, const std::size_t SizeBytes)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    WriteToPipe(mPipeHandleWrite, pData, SizeBytes, mChunkSizeWrite);
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::ReadBytes(char* pData, const std::size_t SizeBytes)
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    ReadFromPipe(mPipeHandleRead, pData, SizeBytes, mChunkSizeRead);
+    #endif
+}
+
+void PipeCommunication::BidirectionalPipe::SendAck()
+{
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    const char ack = 1;
+    WriteToPipe(mPipeHandleAckWrite, &ack, 1, 1);
+    #endif
+}
+
 double PipeCommunication::SendString(
     const Info& I_Info,
     const std::string& rData)
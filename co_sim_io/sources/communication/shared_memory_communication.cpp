@@ -0,0 +1,500 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
+
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Project includes
+#include "includes/communication/shared_memory_communication.hpp"
+#include "includes/utilities.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+std::size_t GetShmBufferSize(const Info& I_Info)
+{
+    return I_Info.Get<std::size_t>("buffer_size", 16*1024*1024); // 16 MB per direction
+}
+
+} // anonymous namespace
+
+// the positions are only increasing (i.e. not wrapped around),
+// the position in the buffer is obtained with the modulo of the capacity
+// the positions are placed on different cache lines to avoid false sharing
+constexpr std::size_t SharedMemoryCommunication::RingBuffer::sAlignment;
+
+struct SharedMemoryCommunication::RingBuffer::Header
+{
+    std::uint64_t Capacity;
+    alignas(64) std::atomic<std::uint64_t> WritePosition;
+    alignas(64) std::atomic<std::uint64_t> ReadPosition;
+};
+
+SharedMemoryCommunication::SharedMemoryCommunication(
+    const Info& I_Settings,
+    std::shared_ptr<DataCommunicator> I_DataComm)
+    : Communication(I_Settings, I_DataComm),
+      mBufferSize(GetShmBufferSize(I_Settings))
+{
+    CO_SIM_IO_ERROR_IF(mBufferSize == 0) << "buffer_size must be larger than 0!" << std::endl;
+    CO_SIM_IO_ERROR_IF(mBufferSize % 8 != 0) << "buffer_size must be a multiple of 8, got " << mBufferSize << "!" << std::endl;
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+    if (GetIsConnected()) {
+        CO_SIM_IO_INFO("CoSimIO") << "Warning: Disconnect was not performed, attempting automatic disconnection!" << std::endl;
+        Info tmp;
+        Disconnect(tmp);
+    }
+}
+
+Info SharedMemoryCommunication::ConnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0) << "Warning: Connection was done with MPI, but shared memory based communication works only within the same machine. Communicating between different compute nodes in a distributed memory machine when does not work, it will hang!" << std::endl;
+
+    const std::string name_p2s = GetSegmentName("p2s");
+    const std::string name_s2p = GetSegmentName("s2p");
+
+    // the primary creates the segments, the secondary waits until this is done before opening them
+    if (GetIsPrimaryConnection()) {
+        mpWriteBuffer = CoSimIO::make_unique<RingBuffer>(name_p2s, mBufferSize, true);
+        mpReadBuffer  = CoSimIO::make_unique<RingBuffer>(name_s2p, mBufferSize, true);
+        SynchronizeAll("shm_1");
+    } else {
+        SynchronizeAll("shm_1");
+        mpWriteBuffer = CoSimIO::make_unique<RingBuffer>(name_s2p, mBufferSize, false);
+        mpReadBuffer  = CoSimIO::make_unique<RingBuffer>(name_p2s, mBufferSize, false);
+    }
+
+    // once both partners have mapped the segments the names are no longer needed
+    // removing them already now avoids leftovers in case one of the partners crashes
+    SynchronizeAll("shm_2");
+    if (GetIsPrimaryConnection()) {
+        mpWriteBuffer->Unlink();
+        mpReadBuffer->Unlink();
+    }
+
+    return Info(); // TODO use
+
+    CO_SIM_IO_CATCH
+}
+
+Info SharedMemoryCommunication::DisconnectDetail(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    // the buffers don't exist if connecting failed
+    if (mpWriteBuffer) {mpWriteBuffer->Close();}
+    if (mpReadBuffer) {mpReadBuffer->Close();}
+
+    return Info(); // TODO use
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_ERROR_IF(GetMyInfo().Get<std::string>("operating_system") != GetPartnerInfo().Get<std::string>("operating_system")) << "Shared memory communication cannot be used between different operating systems!" << std::endl;
+
+    const std::size_t my_buffer_size = GetMyInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
+    const std::size_t partner_buffer_size = GetPartnerInfo().Get<Info>("communication_settings").Get<std::size_t>("buffer_size");
+    CO_SIM_IO_ERROR_IF(my_buffer_size != partner_buffer_size) << "Mismatch in buffer_size!\nMy buffer_size: " << my_buffer_size << "\nPartner buffer_size: " << partner_buffer_size << std::endl;
+}
+
+Info SharedMemoryCommunication::GetCommunicationSettings() const
+{
+    CO_SIM_IO_TRY
+
+    Info info;
+    info.Set("buffer_size", mBufferSize);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+std::string SharedMemoryCommunication::GetSegmentName(const std::string& rDirection) const
+{
+    // names of shared memory segments have to start with a slash and must not contain other slashes
+    return "/CoSimIO_" + GetConnectionName() + "_r" + std::to_string(GetDataCommunicator().Rank()) + "_" + rDirection;
+}
+
+void SharedMemoryCommunication::SendSize(const std::uint64_t Size)
+{
+    mpWriteBuffer->Write(&Size, sizeof(Size));
+}
+
+std::uint64_t SharedMemoryCommunication::ReceiveSize()
+{
+    WaitTimer wait_timer; // blocks until the partner sends
+    std::uint64_t imp_size_u;
+    mpReadBuffer->Read(&imp_size_u, sizeof(imp_size_u));
+    return imp_size_u;
+}
+
+double SharedMemoryCommunication::SendString(
+    const Info& I_Info,
+    const std::string& rData)
+{
+    CO_SIM_IO_TRY
+
+    const auto start_time(std::chrono::steady_clock::now());
+    SendSize(rData.size());
+    mpWriteBuffer->Write(rData.data(), rData.size());
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double SharedMemoryCommunication::ReceiveString(
+    const Info& I_Info,
+    std::string& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+    rData.resize(received_size);
+    if (received_size > 0) {
+        mpReadBuffer->Read(&rData[0], received_size);
+    }
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double SharedMemoryCommunication::SendDataContainer(
+    const Info& I_Info,
+    const Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const auto start_time(std::chrono::steady_clock::now());
+    SendSize(rData.size());
+    mpWriteBuffer->Write(rData.data(), rData.size()*sizeof(double));
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+double SharedMemoryCommunication::ReceiveDataContainer(
+    const Info& I_Info,
+    Internals::DataContainer<double>& rData)
+{
+    CO_SIM_IO_TRY
+
+    const std::size_t received_size = ReceiveSize(); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+    rData.resize(received_size);
+    mpReadBuffer->Read(rData.data(), received_size*sizeof(double));
+    return Utilities::ElapsedSeconds(start_time);
+
+    CO_SIM_IO_CATCH
+}
+
+Info SharedMemoryCommunication::BorrowDataImpl(
+    const Info& I_Info,
+    const double*& O_Data,
+    std::size_t& O_Size)
+{
+    CO_SIM_IO_TRY
+
+    if (GetAlwaysUseSerializer()) {
+        return Communication::BorrowDataImpl(I_Info, O_Data, O_Size);
+    }
+
+    Info info;
+
+    O_Size = ReceiveSize(); // serves also as synchronization for time measurement
+
+    const auto start_time(std::chrono::steady_clock::now());
+    const std::size_t size_in_bytes = O_Size*sizeof(double);
+    O_Data = static_cast<const double*>(mpReadBuffer->Borrow(size_in_bytes));
+
+    if (!O_Data) {
+        // the data is larger than the buffer and hence could not be written contiguously
+        mBorrowBuffer.resize(O_Size);
+        mpReadBuffer->Read(mBorrowBuffer.data(), size_in_bytes);
+        O_Data = mBorrowBuffer.data();
+    }
+
+    info.Set<double>("elapsed_time", Utilities::ElapsedSeconds(start_time));
+    info.Set<std::size_t>("memory_usage_ipc", size_in_bytes);
+    return info;
+
+    CO_SIM_IO_CATCH
+}
+
+Info SharedMemoryCommunication::ReleaseDataImpl(const Info& I_Info)
+{
+    CO_SIM_IO_TRY
+
+    mpReadBuffer->Release();
+    return Info();
+
+    CO_SIM_IO_CATCH
+}
+
+
+SharedMemoryCommunication::RingBuffer::RingBuffer(
+    const std::string& rName,
+    const std::size_t Capacity,
+    const bool Create)
+    : mName(rName)
+{
+    CO_SIM_IO_TRY
+
+    #ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    CO_SIM_IO_ERROR << "Shared memory communication is not yet implemented for Windows!" << std::endl;
+    #else
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory communication requires lock-free 64-bit atomics!");
+
+    int file_descriptor;
+
+    if (Create) {
+        shm_unlink(mName.c_str()); // remove potential leftovers from previous executions
+        CO_SIM_IO_ERROR_IF((file_descriptor = shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666)) < 0) << "Shared memory segment \"" << mName << "\" could not be created: " << std::strerror(errno) << std::endl;
+        fchmod(file_descriptor, 0666); // otherwise the process with lower rights cannot open it
+
+        mCapacity = Capacity;
+        mMappedSize = sizeof(Header) + mCapacity;
+        if (ftruncate(file_descriptor, mMappedSize) != 0) {
+            close(file_descriptor);
+            CO_SIM_IO_ERROR << "Shared memory segment \"" << mName << "\" could not be resized to " << mMappedSize << " bytes!" << std::endl;
+        }
+    } else {
+        CO_SIM_IO_ERROR_IF((file_descriptor = shm_open(mName.c_str(), O_RDWR, 0666)) < 0) << "Shared memory segment \"" << mName << "\" could not be opened: " << std::strerror(errno) << std::endl;
+
+        struct stat segment_stat;
+        CO_SIM_IO_ERROR_IF(fstat(file_descriptor, &segment_stat) != 0) << "Size of shared memory segment \"" << mName << "\" could not be determined!" << std::endl;
+        mMappedSize = segment_stat.st_size;
+    }
+
+    void* p_mapped = mmap(nullptr, mMappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+    close(file_descriptor); // the mapping stays valid after closing
+    CO_SIM_IO_ERROR_IF(p_mapped == MAP_FAILED) << "Shared memory segment \"" << mName << "\" could not be mapped!" << std::endl;
+
+    if (Create) {
+        mpHeader = new (p_mapped) Header;
+        mpHeader->Capacity = mCapacity;
+        mpHeader->WritePosition.store(0);
+        mpHeader->ReadPosition.store(0);
+    } else {
+        mpHeader = static_cast<Header*>(p_mapped);
+        mCapacity = mpHeader->Capacity;
+        CO_SIM_IO_ERROR_IF(sizeof(Header) + mCapacity != mMappedSize) << "Shared memory segment \"" << mName << "\" has an unexpected size!" << std::endl;
+    }
+
+    mpData = static_cast<char*>(p_mapped) + sizeof(Header);
+    CO_SIM_IO_ERROR_IF(mCapacity % sAlignment != 0) << "Capacity of shared memory segment \"" << mName << "\" must be a multiple of " << sAlignment << "!" << std::endl;
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::RingBuffer::Write(const void* pData, const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    const char* p_data = static_cast<const char*>(pData);
+    std::uint64_t write_pos = mpHeader->WritePosition.load(std::memory_order_relaxed); // only modified by this process
+
+    // data that fits into the buffer is always stored contiguously, such that it can be borrowed by the reader
+    write_pos = WaitForFreeSpace(write_pos, GetSkipSize(write_pos, Size));
+
+    std::size_t written_size = 0;
+    while (written_size < Size) {
+        std::size_t free_space = 0;
+        Utilities::WaitUntil([&](){
+            free_space = mCapacity - static_cast<std::size_t>(write_pos - mpHeader->ReadPosition.load(std::memory_order_acquire));
+            return free_space > 0;
+        });
+
+        // only writing until the end of the buffer, the rest is written at the beginning in the next iteration
+        const std::size_t offset = write_pos % mCapacity;
+        const std::size_t chunk_size = std::min({free_space, Size-written_size, mCapacity-offset});
+
+        std::memcpy(mpData+offset, p_data+written_size, chunk_size);
+
+        write_pos += chunk_size;
+        written_size += chunk_size;
+        mpHeader->WritePosition.store(write_pos, std::memory_order_release);
+    }
+
+    // keeping the positions aligned for the next data
+    WaitForFreeSpace(write_pos, GetPaddingSize(Size));
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::RingBuffer::Read(void* pData, const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(mBorrowedSize > 0) << "The borrowed data has to be released before more data can be imported!" << std::endl;
+
+    char* p_data = static_cast<char*>(pData);
+    std::uint64_t read_pos = mpHeader->ReadPosition.load(std::memory_order_relaxed); // only modified by this process
+
+    read_pos = WaitForAvailableData(read_pos, GetSkipSize(read_pos, Size));
+
+    std::size_t read_size = 0;
+    while (read_size < Size) {
+        std::size_t available_size = 0;
+        Utilities::WaitUntil([&](){
+            available_size = static_cast<std::size_t>(mpHeader->WritePosition.load(std::memory_order_acquire) - read_pos);
+            return available_size > 0;
+        });
+
+        const std::size_t offset = read_pos % mCapacity;
+        const std::size_t chunk_size = std::min({available_size, Size-read_size, mCapacity-offset});
+
+        std::memcpy(p_data+read_size, mpData+offset, chunk_size);
+
+        read_pos += chunk_size;
+        read_size += chunk_size;
+        mpHeader->ReadPosition.store(read_pos, std::memory_order_release);
+    }
+
+    WaitForAvailableData(read_pos, GetPaddingSize(Size));
+
+    CO_SIM_IO_CATCH
+}
+
+const void* SharedMemoryCommunication::RingBuffer::Borrow(const std::size_t Size)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF(mBorrowedSize > 0) << "The borrowed data has to be released before more data can be imported!" << std::endl;
+
+    if (Size > mCapacity) {
+        return nullptr; // data was not written contiguously, cannot be borrowed
+    }
+
+    std::uint64_t read_pos = mpHeader->ReadPosition.load(std::memory_order_relaxed);
+    read_pos = WaitForAvailableData(read_pos, GetSkipSize(read_pos, Size));
+
+    // wait until all the data is written, the read position is only advanced once the data is released
+    Utilities::WaitUntil([&](){
+        return static_cast<std::size_t>(mpHeader->WritePosition.load(std::memory_order_acquire) - read_pos) >= Size;
+    });
+
+    mBorrowedSize = Size + GetPaddingSize(Size);
+
+    return mpData + (read_pos % mCapacity);
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::RingBuffer::Release()
+{
+    CO_SIM_IO_TRY
+
+    const std::uint64_t read_pos = mpHeader->ReadPosition.load(std::memory_order_relaxed);
+    WaitForAvailableData(read_pos, mBorrowedSize); // the data is available, this is to include the padding
+    mBorrowedSize = 0;
+
+    CO_SIM_IO_CATCH
+}
+
+std::size_t SharedMemoryCommunication::RingBuffer::GetSkipSize(
+    const std::uint64_t Position,
+    const std::size_t Size) const
+{
+    // data that would wrap around is stored at the beginning of the buffer instead
+    const std::size_t offset = Position % mCapacity;
+    if (Size <= mCapacity && offset + Size > mCapacity) {
+        return mCapacity - offset;
+    }
+    return 0;
+}
+
+std::size_t SharedMemoryCommunication::RingBuffer::GetPaddingSize(const std::size_t Size) const
+{
+    return (sAlignment - Size % sAlignment) % sAlignment;
+}
+
+std::uint64_t SharedMemoryCommunication::RingBuffer::WaitForFreeSpace(
+    const std::uint64_t WritePosition,
+    const std::size_t Size)
+{
+    if (Size == 0) {return WritePosition;}
+
+    Utilities::WaitUntil([&](){
+        return mCapacity - static_cast<std::size_t>(WritePosition - mpHeader->ReadPosition.load(std::memory_order_acquire)) >= Size;
+    });
+
+    mpHeader->WritePosition.store(WritePosition+Size, std::memory_order_release);
+    return WritePosition+Size;
+}
+
+std::uint64_t SharedMemoryCommunication::RingBuffer::WaitForAvailableData(
+    const std::uint64_t ReadPosition,
+    const std::size_t Size)
+{
+    if (Size == 0) {return ReadPosition;}
+
+    Utilities::WaitUntil([&](){
+        return static_cast<std::size_t>(mpHeader->WritePosition.load(std::memory_order_acquire) - ReadPosition) >= Size;
+    });
+
+    mpHeader->ReadPosition.store(ReadPosition+Size, std::memory_order_release);
+    return ReadPosition+Size;
+}
+
+void SharedMemoryCommunication::RingBuffer::Close()
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    if (mpHeader) {
+        munmap(mpHeader, mMappedSize);
+        mpHeader = nullptr;
+        mpData = nullptr;
+    }
+
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+void SharedMemoryCommunication::RingBuffer::Unlink()
+{
+    CO_SIM_IO_TRY
+
+    #ifndef CO_SIM_IO_COMPILED_IN_WINDOWS
+    CO_SIM_IO_ERROR_IF(shm_unlink(mName.c_str()) != 0) << "Shared memory segment \"" << mName << "\" could not be removed: " << std::strerror(errno) << std::endl;
+    #endif
+
+    CO_SIM_IO_CATCH
+}
+
+} // namespace Internals
+} // namespace CoSimIO
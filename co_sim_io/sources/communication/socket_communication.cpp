@@ -138,6 +138,13 @@ SocketCommunication::SocketCommunication(
         mIpAddress = GetIpAddress(I_Settings);
     }
 
+    mNumStreams = I_Settings.Get<int>("num_streams", 1);
+    CO_SIM_IO_ERROR_IF(mNumStreams < 1) << "\"num_streams\" must be at least 1, got: " << mNumStreams << "!" << std::endl;
+
+    mStripingThreshold = I_Settings.Get<std::size_t>("striping_threshold", 1048576);
+
+    CO_SIM_IO_ERROR_IF(mUseAsyncIO && mNumStreams > 1) << "\"use_async_io\" cannot be combined with multiple streams!" << std::endl;
+
     CO_SIM_IO_CATCH
 }
 
@@ -145,7 +152,12 @@ Info SocketCommunication::ConnectDetail(const Info& I_Info)
 {
     CO_SIM_IO_TRY
 
-    if (!GetIsPrimaryConnection()) {GetConnectionInformation();}
+    if (GetIsMToNConnection()) {
+        ConnectPartnerRanks();
+        return BaseType::ConnectDetail(I_Info);
+    }
+
+    if (!GetIsPrimaryConnection()) {GetConnectionInformation(GetDataCommunicator().Rank());}
 
     CO_SIM_IO_INFO_IF("CoSimIO", GetDataCommunicator().IsDistributed() && GetDataCommunicator().Rank()==0 && mIpAddress==LOCAL_IP_ADDRESS) << "Warning: Using the local IP address when connecting with MPI, this does not work in a distributed memory machine when communicating between different compute nodes!\nEither directly specify the IP address (with \"ip_address\") or specify the name of the network to be used (with \"network_name\")!" << std::endl;
 
@@ -154,13 +166,36 @@ Info SocketCommunication::ConnectDetail(const Info& I_Info)
     using namespace asio::ip;
 
     mpAsioSocket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+
+    // the additional sockets for striping large data are connected after the main socket
+    // the client sends the index of each additional socket, such that the order is the same on both sides
+    mAdditionalAsioSockets.resize(mNumStreams-1);
+
     if (GetIsPrimaryConnection()) { // this is the server
         mpAsioAcceptor->accept(*mpAsioSocket);
+
+        for (int i=0; i<mNumStreams-1; ++i) {
+            auto p_socket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+            mpAsioAcceptor->accept(*p_socket);
+            std::uint64_t socket_index;
+            asio::read(*p_socket, asio::buffer(&socket_index, sizeof(socket_index)));
+            CO_SIM_IO_ERROR_IF(socket_index >= mAdditionalAsioSockets.size() || mAdditionalAsioSockets[socket_index]) << "Received invalid socket index: " << socket_index << std::endl;
+            mAdditionalAsioSockets[socket_index] = p_socket;
+        }
+
         mpAsioAcceptor->close();
         mpAsioAcceptor.reset();
     } else { // this is the client
         tcp::endpoint my_endpoint(asio::ip::make_address(mIpAddress), mPortNumber);
         mpAsioSocket->connect(my_endpoint);
+
+        for (int i=0; i<mNumStreams-1; ++i) {
+            auto p_socket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+            p_socket->connect(my_endpoint);
+            const std::uint64_t socket_index = i;
+            asio::write(*p_socket, asio::buffer(&socket_index, sizeof(socket_index)));
+            mAdditionalAsioSockets[i] = p_socket;
+        }
     }
 
     return BaseType::ConnectDetail(I_Info);
@@ -168,6 +203,45 @@ Info SocketCommunication::ConnectDetail(const Info& I_Info)
     CO_SIM_IO_CATCH
 }
 
+void SocketCommunication::ConnectPartnerRanks()
+{
+    CO_SIM_IO_TRY
+
+    // one socket is connected for each partner rank that this rank exchanges data with
+    // the client sends its rank, such that the server can assign the accepted sockets
+    const std::vector<int> partner_ranks = GetConnectedPartnerRanks();
+
+    if (GetIsPrimaryConnection()) { // this is the server
+        CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1) << "Using IP-Address: " << mIpAddress << " and port number: " << mPortNumber << " for " << partner_ranks.size() << " partner rank(s)" << std::endl;
+
+        for (std::size_t i=0; i<partner_ranks.size(); ++i) {
+            auto p_socket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+            mpAsioAcceptor->accept(*p_socket);
+            std::uint64_t partner_rank;
+            asio::read(*p_socket, asio::buffer(&partner_rank, sizeof(partner_rank)));
+            const bool is_partner_rank = std::find(partner_ranks.begin(), partner_ranks.end(), static_cast<int>(partner_rank)) != partner_ranks.end();
+            CO_SIM_IO_ERROR_IF(!is_partner_rank || mPartnerAsioSockets.count(static_cast<int>(partner_rank)) > 0) << "Received invalid partner rank: " << partner_rank << std::endl;
+            mPartnerAsioSockets[static_cast<int>(partner_rank)] = p_socket;
+        }
+
+        mpAsioAcceptor->close();
+        mpAsioAcceptor.reset();
+    } else { // this is the client
+        for (const int partner_rank : partner_ranks) {
+            GetConnectionInformation(partner_rank);
+            CO_SIM_IO_INFO_IF("CoSimIO", GetEchoLevel()>1) << "Using IP-Address: " << mIpAddress << " and port number: " << mPortNumber << " for partner rank " << partner_rank << std::endl;
+
+            auto p_socket = std::make_shared<asio::ip::tcp::socket>(mAsioContext);
+            p_socket->connect(asio::ip::tcp::endpoint(asio::ip::make_address(mIpAddress), mPortNumber));
+            const std::uint64_t my_rank = GetDataCommunicator().Rank();
+            asio::write(*p_socket, asio::buffer(&my_rank, sizeof(my_rank)));
+            mPartnerAsioSockets[partner_rank] = p_socket;
+        }
+    }
+
+    CO_SIM_IO_CATCH
+}
+
 void SocketCommunication::PrepareConnection(const Info& I_Info)
 {
     CO_SIM_IO_TRY
@@ -199,7 +273,7 @@ void SocketCommunication::PrepareConnection(const Info& I_Info)
 
         StreamSerializer serializer(GetSerializerTraceType());
         serializer.save("conn_info", conn_infos);
-        mSerializedConnectionInfo = serializer.GetStringRepresentation();
+        mSerializedConnectionInfo = serializer.ExtractStringRepresentation();
         if (GetSerializerTraceType() != Serializer::TraceType::SERIALIZER_NO_TRACE) {
             PrepareStringForAsciiSerialization(mSerializedConnectionInfo);
         }
@@ -208,11 +282,30 @@ void SocketCommunication::PrepareConnection(const Info& I_Info)
     CO_SIM_IO_CATCH
 }
 
+void SocketCommunication::DerivedHandShake() const
+{
+    CO_SIM_IO_TRY
+
+    BaseType::DerivedHandShake();
+
+    const int my_num_streams = GetMyInfo().Get<Info>("communication_settings").Get<int>("num_streams");
+    const int partner_num_streams = GetPartnerInfo().Get<Info>("communication_settings").Get<int>("num_streams");
+    CO_SIM_IO_ERROR_IF(my_num_streams != partner_num_streams) << "Mismatch in num_streams!\nMy num_streams: " << my_num_streams << "\nPartner num_streams: " << partner_num_streams << std::endl;
+
+    const std::size_t my_striping_threshold = GetMyInfo().Get<Info>("communication_settings").Get<std::size_t>("striping_threshold");
+    const std::size_t partner_striping_threshold = GetPartnerInfo().Get<Info>("communication_settings").Get<std::size_t>("striping_threshold");
+    CO_SIM_IO_ERROR_IF(my_striping_threshold != partner_striping_threshold) << "Mismatch in striping_threshold!\nMy striping_threshold: " << my_striping_threshold << "\nPartner striping_threshold: " << partner_striping_threshold << std::endl;
+
+    CO_SIM_IO_CATCH
+}
+
 Info SocketCommunication::GetCommunicationSettings() const
 {
     CO_SIM_IO_TRY
 
-    Info info;
+    Info info = BaseType::GetCommunicationSettings();
+    info.Set("num_streams", mNumStreams);
+    info.Set("striping_threshold", mStripingThreshold);
 
     if (GetIsPrimaryConnection() && GetDataCommunicator().Rank() == 0) {
         info.Set("connection_info", mSerializedConnectionInfo);
@@ -223,7 +316,7 @@ Info SocketCommunication::GetCommunicationSettings() const
     CO_SIM_IO_CATCH
 }
 
-void SocketCommunication::GetConnectionInformation()
+void SocketCommunication::GetConnectionInformation(const int PartnerRank)
 {
     CO_SIM_IO_TRY
 
@@ -241,9 +334,9 @@ void SocketCommunication::GetConnectionInformation()
     StreamSerializer serializer(serialized_info, GetSerializerTraceType());
     serializer.load("conn_info", conn_infos);
 
-    CO_SIM_IO_ERROR_IF(static_cast<int>(conn_infos.size()) != GetDataCommunicator().Size()) << "Wrong number of connection infos!" << std::endl;
+    CO_SIM_IO_ERROR_IF(static_cast<int>(conn_infos.size()) != partner_info.Get<int>("num_processes")) << "Wrong number of connection infos!" << std::endl;
 
-    const auto& my_conn_info = conn_infos[GetDataCommunicator().Rank()];
+    const auto& my_conn_info = conn_infos[PartnerRank];
     mPortNumber = my_conn_info.PortNumber;
     mIpAddress = my_conn_info.IpAddress;
 
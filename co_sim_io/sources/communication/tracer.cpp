@@ -0,0 +1,157 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <iomanip>
+#include <sstream>
+#include "includes/define.hpp" // for "CO_SIM_IO_COMPILED_IN_WINDOWS"
+#ifdef CO_SIM_IO_COMPILED_IN_WINDOWS
+    #include <process.h>
+    #define getpid _getpid
+#else
+    #include <unistd.h>
+#endif
+
+// Project includes
+#include "includes/communication/tracer.hpp"
+#include "includes/utilities.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+namespace {
+
+std::string EscapeJson(const std::string& rString)
+{
+    std::stringstream escaped;
+    for (const char c : rString) {
+        switch (c) {
+            case '"':  escaped << "\\\""; break;
+            case '\\': escaped << "\\\\"; break;
+            case '\n': escaped << "\\n";  break;
+            case '\t': escaped << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    escaped << c;
+                }
+        }
+    }
+    return escaped.str();
+}
+
+}
+
+constexpr std::size_t Tracer::MaxBufferedEvents;
+
+Tracer::Tracer(
+    const fs::path& rFileName,
+    const std::string& rProcessName)
+    : mFileName(rFileName),
+      mProcessName(rProcessName),
+      mSteadyReferenceTime(std::chrono::steady_clock::now()),
+      mSystemReferenceTime(std::chrono::duration<double, std::micro>(std::chrono::system_clock::now().time_since_epoch()).count())
+{
+}
+
+void Tracer::AddEvent(
+    const std::string& rName,
+    const std::string& rCategory,
+    const std::string& rDetail,
+    const std::chrono::steady_clock::time_point& rStartTime,
+    const std::chrono::steady_clock::time_point& rEndTime)
+{
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    Event event;
+    event.Name = rName;
+    event.Category = rCategory;
+    event.Detail = rDetail;
+    event.Timestamp = mSystemReferenceTime + Microseconds(rStartTime - mSteadyReferenceTime).count();
+    event.Duration = Microseconds(rEndTime - rStartTime).count();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mIsCompleted) {return;}
+    const auto thread_index = mThreadIndices.insert({std::this_thread::get_id(), static_cast<int>(mThreadIndices.size())});
+    event.ThreadIndex = thread_index.first->second;
+    mEvents.push_back(std::move(event));
+
+    if (mEvents.size() >= MaxBufferedEvents) {
+        FlushEvents();
+    }
+}
+
+void Tracer::WriteFile()
+{
+    CO_SIM_IO_TRY
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mIsCompleted) {return;}
+
+    FlushEvents();
+
+    mFile << "\n]}\n";
+    mFile.close();
+    mIsCompleted = true;
+
+    CO_SIM_IO_CATCH
+}
+
+Tracer* Tracer::GetActive()
+{
+    return ActiveTracer();
+}
+
+void Tracer::FlushEvents()
+{
+    CO_SIM_IO_TRY
+
+    // the process id is used such that the files of different processes can be merged
+    const int process_id = static_cast<int>(getpid());
+
+    if (!mFile.is_open()) {
+        mFile.open(mFileName.string());
+        Utilities::CheckStream(mFile, mFileName);
+
+        mFile << std::fixed << std::setprecision(3);
+        mFile << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        mFile << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << process_id << ", \"args\": {\"name\": \"" << EscapeJson(mProcessName) << "\"}}";
+    }
+
+    for (const auto& r_event : mEvents) {
+        mFile << ",\n{\"name\": \"" << EscapeJson(r_event.Name)
+            << "\", \"cat\": \"" << EscapeJson(r_event.Category)
+            << "\", \"ph\": \"X\", \"ts\": " << r_event.Timestamp
+            << ", \"dur\": " << r_event.Duration
+            << ", \"pid\": " << process_id
+            << ", \"tid\": " << r_event.ThreadIndex;
+        if (!r_event.Detail.empty()) {
+            mFile << ", \"args\": {\"detail\": \"" << EscapeJson(r_event.Detail) << "\"}";
+        }
+        mFile << "}";
+    }
+    mFile.flush();
+
+    mEvents.clear();
+
+    CO_SIM_IO_CATCH
+}
+
+Tracer*& Tracer::ActiveTracer()
+{
+    static thread_local Tracer* p_active_tracer = nullptr;
+    return p_active_tracer;
+}
+
+} // namespace Internals
+} // namespace CoSimIO
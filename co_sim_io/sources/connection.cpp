@@ -80,6 +80,7 @@ Info Connection::Run(const Info& I_Info)
                 err_msg << "\n    end" << std::endl;
                 CO_SIM_IO_ERROR << err_msg.str();
             }
+            TraceScope trace_scope(mpComm->GetTracer(), "Run", "run", control_signal);
             it_fct->second(info.Get<Info>("settings", Info{})); // pass settings if specified
         }
     }
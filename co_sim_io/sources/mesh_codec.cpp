@@ -0,0 +1,156 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <unordered_map>
+
+// Project includes
+#include "includes/mesh_codec.hpp"
+
+namespace CoSimIO {
+namespace Internals {
+
+void MeshCodec::save(Serializer& rSerializer) const
+{
+    CO_SIM_IO_TRY
+
+    const ModelPart& r_model_part = *mpConstModelPart;
+
+    // nodes, in the same order as in the ModelPart (local and ghost nodes mixed)
+    const std::size_t num_nodes = r_model_part.NumberOfNodes();
+    std::vector<IdType> node_ids(num_nodes);
+    std::vector<double> x(num_nodes);
+    std::vector<double> y(num_nodes);
+    std::vector<double> z(num_nodes);
+
+    std::size_t counter = 0;
+    for (auto it_node = r_model_part.NodesBegin(); it_node != r_model_part.NodesEnd(); ++it_node, ++counter) {
+        const Node& r_node = **it_node;
+        node_ids[counter] = r_node.Id();
+        x[counter] = r_node.X();
+        y[counter] = r_node.Y();
+        z[counter] = r_node.Z();
+    }
+
+    rSerializer.save("node_ids", node_ids);
+    rSerializer.save("x", x);
+    rSerializer.save("y", y);
+    rSerializer.save("z", z);
+
+    // the partition indices are only saved if there are ghost nodes, -1 is used for local nodes
+    const std::size_t num_ghost_nodes = r_model_part.NumberOfGhostNodes();
+    rSerializer.save("num_ghost_nodes", num_ghost_nodes);
+    if (num_ghost_nodes > 0) {
+        std::unordered_map<IdType, int> ghost_node_partitions;
+        ghost_node_partitions.reserve(num_ghost_nodes);
+        for (const auto& r_partition : r_model_part.GetPartitionModelParts()) {
+            for (auto it_node = r_partition.second->NodesBegin(); it_node != r_partition.second->NodesEnd(); ++it_node) {
+                ghost_node_partitions[(*it_node)->Id()] = r_partition.first;
+            }
+        }
+
+        std::vector<int> partition_indices(num_nodes, -1);
+        for (std::size_t i=0; i<num_nodes; ++i) {
+            const auto it_partition = ghost_node_partitions.find(node_ids[i]);
+            if (it_partition != ghost_node_partitions.end()) {
+                partition_indices[i] = it_partition->second;
+            }
+        }
+
+        rSerializer.save("partition_indices", partition_indices);
+    }
+
+    // elements, the number of nodes per element is given by the type
+    const std::size_t num_elements = r_model_part.NumberOfElements();
+    std::vector<IdType> element_ids(num_elements);
+    std::vector<int> element_types(num_elements);
+    std::size_t num_connectivities = 0;
+
+    counter = 0;
+    for (auto it_elem = r_model_part.ElementsBegin(); it_elem != r_model_part.ElementsEnd(); ++it_elem, ++counter) {
+        element_ids[counter] = (*it_elem)->Id();
+        element_types[counter] = static_cast<int>((*it_elem)->Type());
+        num_connectivities += (*it_elem)->NumberOfNodes();
+    }
+
+    ConnectivitiesType connectivities;
+    connectivities.reserve(num_connectivities);
+    for (auto it_elem = r_model_part.ElementsBegin(); it_elem != r_model_part.ElementsEnd(); ++it_elem) {
+        for (auto it_node = (*it_elem)->NodesBegin(); it_node != (*it_elem)->NodesEnd(); ++it_node) {
+            connectivities.push_back((*it_node)->Id());
+        }
+    }
+
+    rSerializer.save("element_ids", element_ids);
+    rSerializer.save("element_types", element_types);
+    rSerializer.save("connectivities", connectivities);
+
+    CO_SIM_IO_CATCH
+}
+
+void MeshCodec::load(Serializer& rSerializer)
+{
+    CO_SIM_IO_TRY
+
+    CO_SIM_IO_ERROR_IF_NOT(mpModelPart) << "Loading into a const ModelPart is not possible!" << std::endl;
+
+    ModelPart& r_model_part = *mpModelPart;
+    r_model_part.Clear();
+
+    std::vector<IdType> node_ids;
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+    rSerializer.load("node_ids", node_ids);
+    rSerializer.load("x", x);
+    rSerializer.load("y", y);
+    rSerializer.load("z", z);
+
+    std::size_t num_ghost_nodes;
+    rSerializer.load("num_ghost_nodes", num_ghost_nodes);
+    if (num_ghost_nodes == 0) {
+        r_model_part.CreateNewNodes(node_ids, x, y, z);
+    } else {
+        std::vector<int> partition_indices;
+        rSerializer.load("partition_indices", partition_indices);
+
+        for (std::size_t i=0; i<node_ids.size(); ++i) {
+            if (partition_indices[i] < 0) {
+                r_model_part.CreateNewNode(node_ids[i], x[i], y[i], z[i]);
+            } else {
+                r_model_part.CreateNewGhostNode(node_ids[i], x[i], y[i], z[i], partition_indices[i]);
+            }
+        }
+    }
+
+    std::vector<IdType> element_ids;
+    std::vector<int> element_types;
+    ConnectivitiesType connectivities;
+
+    rSerializer.load("element_ids", element_ids);
+    rSerializer.load("element_types", element_types);
+    rSerializer.load("connectivities", connectivities);
+
+    std::vector<ElementType> types(element_types.size());
+    for (std::size_t i=0; i<element_types.size(); ++i) {
+        types[i] = static_cast<ElementType>(element_types[i]);
+    }
+
+    r_model_part.CreateNewElements(element_ids, types, connectivities);
+
+    CO_SIM_IO_CATCH
+}
+
+} // namespace Internals
+} // namespace CoSimIO
@@ -13,6 +13,10 @@
 
 // System includes
 #include <iomanip>
+#include <streambuf>
+#include <cstring>
+#include <climits>
+#include <algorithm>
 
 // Project includes
 #include "includes/stream_serializer.hpp"
@@ -20,8 +24,161 @@
 namespace CoSimIO {
 namespace Internals {
 
+namespace {
+
+// Stream buffer that either writes into a growable contiguous string,
+// or reads directly from memory that is owned by someone else (span)
+class StreamSerializerBuffer : public std::streambuf
+{
+public:
+    StreamSerializerBuffer()
+    {
+        SetAreas(0, 0);
+    }
+
+    explicit StreamSerializerBuffer(std::string&& rData)
+        : mData(std::move(rData))
+    {
+        SetAreas(mData.size(), 0);
+    }
+
+    StreamSerializerBuffer(const char* pData, const std::size_t Size)
+        : mIsSpan(true)
+    {
+        char* p_data = const_cast<char*>(pData); // the get area is never written
+        setg(p_data, p_data, p_data+Size);
+    }
+
+    const std::string& GetString()
+    {
+        CO_SIM_IO_ERROR_IF(mIsSpan) << "The data of the serializer is not owned by it!" << std::endl;
+
+        // remove the unused capacity at the end
+        const std::size_t gpos = gptr()-eback();
+        mData.resize(pptr()-pbase());
+        SetAreas(mData.size(), gpos);
+
+        return mData;
+    }
+
+    std::string ExtractString()
+    {
+        GetString();
+
+        std::string data;
+        data.swap(mData);
+        SetAreas(0, 0);
+
+        return data;
+    }
+
+protected:
+    int_type overflow(int_type Char) override
+    {
+        if (traits_type::eq_int_type(Char, traits_type::eof())) {
+            return traits_type::not_eof(Char);
+        }
+
+        if (mIsSpan) {
+            return traits_type::eof();
+        }
+
+        Grow(1);
+        *pptr() = traits_type::to_char_type(Char);
+        PutBump(1);
+
+        return Char;
+    }
+
+    std::streamsize xsputn(const char* pChars, std::streamsize Count) override
+    {
+        if (mIsSpan) {
+            return 0;
+        }
+
+        if (epptr()-pptr() < Count) {
+            Grow(static_cast<std::size_t>(Count));
+        }
+        std::memcpy(pptr(), pChars, static_cast<std::size_t>(Count));
+        PutBump(static_cast<std::size_t>(Count));
+
+        return Count;
+    }
+
+    int_type underflow() override
+    {
+        // make the data written in the meantime available for reading
+        if (!mIsSpan && pptr() > egptr()) {
+            setg(eback(), gptr(), pptr());
+        }
+
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        return traits_type::eof();
+    }
+
+private:
+    std::string mData;
+    bool mIsSpan = false;
+
+    // the whole string is used as put area, the written data is [pbase, pptr)
+    void SetAreas(const std::size_t NumWritten, const std::size_t ReadPosition)
+    {
+        char* p_data = &mData[0];
+        setp(p_data, p_data+mData.size());
+        PutBump(NumWritten);
+        setg(p_data, p_data+ReadPosition, p_data+NumWritten);
+    }
+
+    // pbump only accepts int
+    void PutBump(std::size_t Count)
+    {
+        while (Count > 0) {
+            const int bump = static_cast<int>(std::min(Count, static_cast<std::size_t>(INT_MAX)));
+            pbump(bump);
+            Count -= bump;
+        }
+    }
+
+    void Grow(const std::size_t MinAdditionalSize)
+    {
+        const std::size_t num_written = pptr()-pbase();
+        const std::size_t gpos = gptr()-eback();
+
+        mData.resize(std::max({2*mData.size(), num_written+MinAdditionalSize, static_cast<std::size_t>(1024)}));
+        SetAreas(num_written, gpos);
+    }
+};
+
+// iostream owning its buffer, as the Serializer deletes the stream
+class StreamSerializerStream : public std::iostream
+{
+public:
+    template<class... TArgs>
+    explicit StreamSerializerStream(TArgs&&... Args)
+        : std::iostream(nullptr),
+          mBuffer(std::forward<TArgs>(Args)...)
+    {
+        rdbuf(&mBuffer);
+    }
+
+    StreamSerializerBuffer& GetBuffer() {return mBuffer;}
+
+private:
+    StreamSerializerBuffer mBuffer;
+};
+
+StreamSerializerBuffer& GetStreamBuffer(Serializer::BufferType* pBuffer)
+{
+    return static_cast<StreamSerializerStream*>(pBuffer)->GetBuffer();
+}
+
+} // anonymous namespace
+
 StreamSerializer::StreamSerializer(TraceType const& rTrace)
-    : Serializer(new std::stringstream(std::ios::binary|std::ios::in|std::ios::out),rTrace)
+    : Serializer(new StreamSerializerStream(), rTrace)
 {
     // increase precision when using ascii
     if (rTrace != SERIALIZER_NO_TRACE) {
@@ -29,10 +186,37 @@ StreamSerializer::StreamSerializer(TraceType const& rTrace)
     }
 }
 
-StreamSerializer::StreamSerializer(const std::string& rData,TraceType const& rTrace)
-    : StreamSerializer(rTrace)
+StreamSerializer::StreamSerializer(const std::string& rData, TraceType const& rTrace)
+    : StreamSerializer(rData.data(), rData.size(), rTrace)
+{
+}
+
+StreamSerializer::StreamSerializer(std::string&& rData, TraceType const& rTrace)
+    : Serializer(new StreamSerializerStream(std::move(rData)), rTrace)
+{
+    // increase precision when using ascii
+    if (rTrace != SERIALIZER_NO_TRACE) {
+        *pGetBuffer() << std::setprecision(14);
+    }
+}
+
+StreamSerializer::StreamSerializer(const char* pData, const std::size_t Size, TraceType const& rTrace)
+    : Serializer(new StreamSerializerStream(pData, Size), rTrace)
+{
+    // increase precision when using ascii
+    if (rTrace != SERIALIZER_NO_TRACE) {
+        *pGetBuffer() << std::setprecision(14);
+    }
+}
+
+const std::string& StreamSerializer::GetStringRepresentation()
+{
+    return GetStreamBuffer(pGetBuffer()).GetString();
+}
+
+std::string StreamSerializer::ExtractStringRepresentation()
 {
-    *(this->pGetBuffer()) << rData << std::endl;
+    return GetStreamBuffer(pGetBuffer()).ExtractString();
 }
 
 } // namespace Internals
@@ -11,6 +11,7 @@
 //
 
 // System includes
+#include <algorithm>
 #include <string>
 #include <map>
 #include <chrono>
@@ -21,9 +22,100 @@
 // Project includes
 #include "includes/utilities.hpp"
 
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
 namespace CoSimIO {
 namespace Utilities {
 
+namespace {
+
+// the time between the checks is doubled after every unsuccessful check
+// the maximum limits the delay for noticing that the condition is fulfilled
+template<class TConditionType>
+void WaitWithBackoff(TConditionType&& rCondition)
+{
+    std::chrono::microseconds sleep_time(10);
+    const std::chrono::microseconds max_sleep_time(10000);
+
+    while (!rCondition()) {
+        std::this_thread::sleep_for(sleep_time);
+        sleep_time = std::min(2*sleep_time, max_sleep_time);
+    }
+}
+
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX
+// returns false if inotify could not be set up, then the caller has to use a different strategy
+template<class TConditionType>
+bool WaitWithInotify(
+    const fs::path& rPath,
+    const bool WaitForCreation,
+    TConditionType&& rCondition)
+{
+    const int inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0) {return false;}
+
+    fs::path directory = rPath.parent_path();
+    if (directory.empty()) {directory = ".";}
+
+    const uint32_t event_mask = WaitForCreation ? (IN_CREATE | IN_MOVED_TO) : (IN_DELETE | IN_MOVED_FROM);
+    if (inotify_add_watch(inotify_fd, directory.c_str(), event_mask | IN_ONLYDIR) < 0) {
+        close(inotify_fd);
+        return false;
+    }
+
+    // the events are not used directly, they only trigger checking the condition again
+    // if no event arrives within the timeout the condition is checked anyway, as
+    // filesystems shared across compute nodes don't issue events for changes made on other nodes
+    int timeout_ms = 1;
+    const int max_timeout_ms = 100;
+    alignas(struct inotify_event) char event_buffer[4096];
+
+    // checking after the watch was added, to not miss events between checking and adding the watch
+    while (!rCondition()) {
+        struct pollfd poll_fd;
+        poll_fd.fd = inotify_fd;
+        poll_fd.events = POLLIN;
+        const int poll_result = poll(&poll_fd, 1, timeout_ms);
+
+        if (poll_result > 0) {
+            while (read(inotify_fd, event_buffer, sizeof(event_buffer)) > 0) {} // discard all pending events
+        } else {
+            timeout_ms = std::min(2*timeout_ms, max_timeout_ms);
+        }
+    }
+
+    close(inotify_fd);
+    return true;
+}
+#endif
+
+template<class TConditionType>
+void WaitForFilesystem(
+    const fs::path& rPath,
+    const bool WaitForCreation,
+    const FileWaitStrategy Strategy,
+    TConditionType&& rCondition)
+{
+    if (Strategy == FileWaitStrategy::Polling) {
+        while(!rCondition()) {std::this_thread::sleep_for(std::chrono::microseconds(10));}
+        return;
+    }
+
+    #ifdef CO_SIM_IO_COMPILED_IN_LINUX
+    if (Strategy == FileWaitStrategy::Inotify && WaitWithInotify(rPath, WaitForCreation, rCondition)) {
+        return;
+    }
+    #endif
+
+    WaitWithBackoff(rCondition);
+}
+
+} // anonymous namespace
+
 // Create the name for the connection
 // In a function bcs maybe in the future this will
 // need to be more elaborate
@@ -188,10 +280,36 @@ std::string GetElementName(const ElementType I_ElementType)
     CO_SIM_IO_ERROR << "Unknown Element type!" << std::endl;
 }
 
-void WaitUntilPathExists(const fs::path& rPath)
+std::string FileWaitStrategyToString(const FileWaitStrategy Strategy)
+{
+    if (Strategy == FileWaitStrategy::Polling) {return "polling";}
+    else if (Strategy == FileWaitStrategy::Backoff) {return "backoff";}
+    else if (Strategy == FileWaitStrategy::Inotify) {return "inotify";}
+    else {CO_SIM_IO_ERROR << "Invalid file_wait_strategy! Valid options are: polling, backoff, inotify" << std::endl;}
+}
+
+FileWaitStrategy StringToFileWaitStrategy(const std::string& rStrategy)
+{
+    if (rStrategy == "polling") {return FileWaitStrategy::Polling;}
+    else if (rStrategy == "backoff") {return FileWaitStrategy::Backoff;}
+    else if (rStrategy == "inotify") {return FileWaitStrategy::Inotify;}
+    else {CO_SIM_IO_ERROR << "Invalid file_wait_strategy: \"" << rStrategy << "\"! Valid options are: polling, backoff, inotify" << std::endl;}
+}
+
+void WaitUntilPathExists(
+    const fs::path& rPath,
+    const FileWaitStrategy Strategy)
+{
+    std::error_code ec;
+    WaitForFilesystem(rPath, true, Strategy, [&rPath, &ec](){return fs::exists(rPath, ec);});
+}
+
+void WaitUntilPathIsRemoved(
+    const fs::path& rPath,
+    const FileWaitStrategy Strategy)
 {
     std::error_code ec;
-    while(!fs::exists(rPath, ec)) {std::this_thread::sleep_for(std::chrono::microseconds(10));} // wait 0.005s before next check
+    WaitForFilesystem(rPath, false, Strategy, [&rPath, &ec](){return !fs::exists(rPath, ec);});
 }
 
 std::set<std::size_t> ComputePartnerRanksAsImporter(
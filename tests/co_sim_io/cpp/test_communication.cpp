@@ -13,6 +13,8 @@
 // System includes
 #include <thread>
 #include <chrono>
+#include <fstream>
+#include <iterator>
 #include <tuple>
 #include <array>
 #include <numeric>
@@ -21,6 +23,7 @@
 #include "co_sim_io_testing.hpp"
 #include "includes/communication/communication.hpp"
 #include "includes/communication/factory.hpp"
+#include "includes/connection.hpp"
 
 namespace {
 
@@ -276,6 +279,86 @@ void ExportDataHelper(
     CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
 }
 
+void ExportDataDelayedHelper(
+    CoSimIO::Info settings,
+    const std::vector<double>& DataToExport,
+    const std::chrono::milliseconds Delay)
+{
+    settings.Set<std::string>("my_name", "thread");
+    settings.Set<std::string>("connect_to", "main");
+    settings.Set<bool>("is_primary_connection", false);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the secondary thread should wait a bit until the primary has created the folder!
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    // the partner has to wait for the data
+    std::this_thread::sleep_for(Delay);
+
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", "data_exchange");
+    const CoSimIO::Internals::DataContainerStdVectorReadOnly<double> data_container(DataToExport);
+    p_comm->ExportData(export_info, data_container);
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+}
+
+void ExchangeDataAsyncHelper(
+    CoSimIO::Info settings,
+    const std::vector<std::vector<double>>& DataToExport,
+    const std::vector<double>& DataToImport)
+{
+    settings.Set<std::string>("my_name", "thread");
+    settings.Set<std::string>("connect_to", "main");
+    settings.Set<bool>("is_primary_connection", false);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    // the secondary thread should wait a bit until the primary has created the folder!
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CoSimIO::Info connect_info;
+    CoSimIO::Info ret_info_connect = p_comm->Connect(connect_info);
+
+    CHECK_UNARY(ret_info_connect.Get<bool>("is_connected"));
+
+    // the import is started first, both partners would block if it was not done in the background
+    std::vector<double> imported_data;
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "data_exchange_back");
+    const CoSimIO::Info import_request = p_comm->ImportDataAsync(import_info, std::make_shared<CoSimIO::Internals::DataContainerStdVector<double>>(imported_data));
+
+    CoSimIO::Info export_info;
+    export_info.Set<std::string>("identifier", "data_exchange");
+
+    std::vector<CoSimIO::Info> export_requests;
+    for (const auto& data : DataToExport) {
+        export_requests.push_back(p_comm->ExportDataAsync(export_info, std::make_shared<CoSimIO::Internals::DataContainerStdVectorReadOnly<double>>(data)));
+    }
+
+    for (const auto& r_request : export_requests) {
+        const CoSimIO::Info ret_info = p_comm->Wait(r_request);
+        CHECK_UNARY(ret_info.Has("elapsed_time"));
+    }
+
+    p_comm->Wait(import_request);
+    CO_SIM_IO_CHECK_VECTOR_NEAR(imported_data, DataToImport);
+
+    CoSimIO::Info disconnect_info;
+    CoSimIO::Info ret_info_disconnect = p_comm->Disconnect(disconnect_info);
+
+    CHECK_UNARY_FALSE(ret_info_disconnect.Get<bool>("is_connected"));
+}
+
 void ExportMeshHelper(
     CoSimIO::Info settings,
     const std::vector<std::shared_ptr<CoSimIO::ModelPart>>& ModelPartsToExport)
@@ -469,6 +552,192 @@ void RunAllCommunication(CoSimIO::Info settings)
         ext_thread.join();
     }
 
+    SUBCASE("performance_statistics")
+    {
+        const std::vector<std::vector<double>> exp_data {
+            {1.1, -6.1, 535.789, 5487},
+            {1.2, -6.01, 552.789},
+            {-11.56}
+        };
+        std::thread ext_thread(ExportDataHelper, settings, exp_data);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        std::vector<double> data;
+        CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+        double wait_time = 0.0;
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            const CoSimIO::Info o_info = p_comm->ImportData(import_info, data_container);
+            REQUIRE(o_info.Has("elapsed_time_wait"));
+            CHECK_GE(o_info.Get<double>("elapsed_time_wait"), 0.0);
+            wait_time += o_info.Get<double>("elapsed_time_wait");
+        }
+
+        const CoSimIO::Info statistics = p_comm->GetPerformanceStatistics();
+        REQUIRE_EQ(statistics.Size(), 1);
+        const CoSimIO::Info& r_import_stats = statistics.Get<CoSimIO::Info>("data_exchange").Get<CoSimIO::Info>("import_data");
+        CHECK_EQ(r_import_stats.Get<int>("count"), 3);
+        CHECK_GT(r_import_stats.Get<double>("bytes"), 0.0);
+
+        for (const std::string& r_category : std::vector<std::string>{"time", "wait", "serialize", "transfer"}) {
+            CAPTURE(r_category);
+            const CoSimIO::Info& r_time_stats = r_import_stats.Get<CoSimIO::Info>(r_category);
+            CHECK_GE(r_time_stats.Get<double>("min"), 0.0);
+            CHECK_LE(r_time_stats.Get<double>("min"), r_time_stats.Get<double>("max"));
+            CHECK_LE(r_time_stats.Get<double>("max"), r_time_stats.Get<double>("total"));
+
+            const CoSimIO::Info& r_histogram = r_time_stats.Get<CoSimIO::Info>("histogram");
+            int num_entries = 0;
+            for (std::size_t i=0; i<CoSimIO::Internals::PerformanceStatistics::NumberOfHistogramBins; ++i) {
+                num_entries += r_histogram.Get<int>("bin_"+std::to_string(i));
+            }
+            CHECK_EQ(num_entries, 3);
+        }
+
+        // the waiting is reported by the operations themselves
+        CHECK_EQ(r_import_stats.Get<CoSimIO::Info>("wait").Get<double>("total"), doctest::Approx(wait_time));
+
+        p_comm->ResetPerformanceStatistics();
+        CHECK_EQ(p_comm->GetPerformanceStatistics().Size(), 0);
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("elapsed_time_wait")
+    {
+        const std::vector<double> exp_data {1.1, -6.1, 535.789, 5487};
+        const std::chrono::milliseconds delay(200);
+        std::thread ext_thread(ExportDataDelayedHelper, settings, exp_data, delay);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        std::vector<double> data;
+        CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+        const CoSimIO::Info o_info = p_comm->ImportData(import_info, data_container);
+        CO_SIM_IO_CHECK_VECTOR_NEAR(data_container, exp_data);
+
+        // the partners might not leave Connect at exactly the same time, hence some tolerance
+        const double min_wait_time = 0.75 * std::chrono::duration<double>(delay).count();
+        CHECK_GE(o_info.Get<double>("elapsed_time_wait"), min_wait_time);
+        CHECK_LT(o_info.Get<double>("elapsed_time"), min_wait_time);
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("import_export_data_async")
+    {
+        const std::vector<std::vector<double>> exp_data {
+            {1.1, -6.1, 535.789, 5487},
+            {1.2, -6.01, 552.789, 5477, 1.0, -6.19, -655.789, 91.5888867},
+            {},
+            {-11.56}
+        };
+        const std::vector<double> exp_data_back {-7.5, 88.123, 0.00025};
+        std::thread ext_thread(ExchangeDataAsyncHelper, settings, exp_data, exp_data_back);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+
+        // all but the last one are imported asynchronously
+        // the blocking import of the last one has to complete the pending requests first
+        std::vector<std::vector<double>> data(exp_data.size());
+        std::vector<CoSimIO::Info> import_requests;
+        for (std::size_t i=0; i<exp_data.size()-1; ++i) {
+            import_requests.push_back(p_comm->ImportDataAsync(import_info, std::make_shared<CoSimIO::Internals::DataContainerStdVector<double>>(data[i])));
+        }
+
+        const CoSimIO::Info test_info = p_comm->Test(import_requests[0]);
+        CHECK_UNARY(test_info.Has("is_completed"));
+
+        CoSimIO::Internals::DataContainerStdVector<double> last_data_container(data.back());
+        p_comm->ImportData(import_info, last_data_container);
+
+        CoSimIO::Info export_info;
+        export_info.Set<std::string>("identifier", "data_exchange_back");
+        p_comm->ExportData(export_info, CoSimIO::Internals::DataContainerStdVectorReadOnly<double>(exp_data_back));
+
+        // the requests are completed, but still have to be waited for
+        CHECK_UNARY(p_comm->Test(import_requests.back()).Get<bool>("is_completed"));
+
+        for (std::size_t i=0; i<import_requests.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            const CoSimIO::Info ret_info = p_comm->Wait(import_requests[i]);
+            CHECK_UNARY(ret_info.Has("elapsed_time"));
+        }
+
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            CO_SIM_IO_CHECK_VECTOR_NEAR(data[i], exp_data[i]);
+        }
+
+        // a request can only be waited for once
+        CHECK_THROWS_WITH(p_comm->Wait(import_requests[0]), doctest::Contains("Request 0 does not exist or was already completed!"));
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
+    SUBCASE("borrow_data_multiple")
+    {
+        std::vector<std::vector<double>> exp_data {
+            {1.1, -6.1, 535.789, 5487},
+            {1.2, -6.01, 552.789, 5477, 1.0, -6.19, -655.789, 91.5888867},
+            {},
+            {-11.56},
+            {}
+        };
+        // larger than the buffer of some communications, hence it cannot be borrowed directly
+        exp_data.back().resize(1000);
+        std::iota(exp_data.back().begin(), exp_data.back().end(), 0);
+
+        std::thread ext_thread(ExportDataHelper, settings, exp_data);
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        CoSimIO::Info import_info;
+        import_info.Set<std::string>("identifier", "data_exchange");
+        for (std::size_t i=0; i<exp_data.size(); ++i) {
+            CAPTURE(i); // log the current input data (done manually as not fully supported yet by doctest)
+            const double* p_data = nullptr;
+            std::size_t size = 0;
+            p_comm->BorrowData(import_info, p_data, size);
+
+            // releasing is required before borrowing again
+            CHECK_THROWS_WITH(p_comm->BorrowData(import_info, p_data, size), doctest::Contains("was already borrowed"));
+
+            const CoSimIO::Internals::DataContainerRawMemoryReadOnly<double> data_view(p_data, size);
+            CO_SIM_IO_CHECK_VECTOR_NEAR(data_view, exp_data[i]);
+            p_comm->ReleaseData(import_info);
+        }
+
+        CHECK_THROWS_WITH(p_comm->ReleaseData(import_info), doctest::Contains("cannot be released as it was not borrowed"));
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+
+        ext_thread.join();
+    }
+
     SUBCASE("import_export_large_data")
     {
         // this test is especially for the pipe communication,
@@ -624,6 +893,212 @@ TEST_CASE("FileCommunication_avail_file" * doctest::timeout(250))
     RunAllCommunication(settings);
 }
 
+TEST_CASE("FileCommunication_file_wait_strategy_backoff" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("file_wait_strategy", "backoff");
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_file_wait_strategy_inotify" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<std::string>("file_wait_strategy", "inotify");
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_async_send" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_async_send", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_async_send_stream_serializer" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_async_send", true);
+    settings.Set<bool>("use_file_serializer", false);
+    settings.Set<int>("max_queued_sends", 1);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("FileCommunication_mmap" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<bool>("use_mmap", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // mmap is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+std::string ReadAndRemoveTraceFile(const fs::path& rTraceFileName)
+{
+    REQUIRE_UNARY(fs::exists(rTraceFileName));
+
+    std::ifstream trace_file(rTraceFileName.string());
+    const std::string trace((std::istreambuf_iterator<char>(trace_file)), std::istreambuf_iterator<char>());
+    trace_file.close();
+    fs::remove(rTraceFileName);
+
+    CHECK_EQ(trace.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["), 0);
+
+    return trace;
+}
+
+void CheckTraceHasEvents(
+    const std::string& rTrace,
+    const std::vector<std::string>& rEventNames)
+{
+    for (const std::string& r_event : rEventNames) {
+        CAPTURE(r_event);
+        CHECK_NE(rTrace.find("{\"name\": \""+r_event+"\", "), std::string::npos);
+    }
+}
+
+TEST_CASE("FileCommunication_trace" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+
+    // only the primary writes a trace, as both partners run with rank 0 in this process
+    const CoSimIO::Info settings_partner(settings);
+    settings.Set<std::string>("trace_file", "trace_test");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    std::thread ext_thread(ExportDataHelper, settings_partner, std::vector<std::vector<double>>{{1.1, -6.1, 535.789}});
+
+    CoSimIO::Info connect_info;
+    p_comm->Connect(connect_info);
+
+    std::vector<double> data;
+    CoSimIO::Internals::DataContainerStdVector<double> data_container(data);
+
+    CoSimIO::Info import_info;
+    import_info.Set<std::string>("identifier", "data_exchange");
+    p_comm->ImportData(import_info, data_container);
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+
+    // the rank and the default extension are appended
+    const std::string trace = ReadAndRemoveTraceFile("trace_test_0.json");
+
+    CheckTraceHasEvents(trace, {"Connect", "HandShake", "WaitForPath", "SynchronizeAll", "ImportData", "transfer", "wait", "Disconnect"});
+    CHECK_NE(trace.find("\"args\": {\"detail\": \"data_exchange\"}"), std::string::npos);
+}
+
+TEST_CASE("FileCommunication_trace_run" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "file");
+    settings.Set<int>("echo_level", 0);
+
+    // both partners write a trace, the names have to differ as both run with rank 0 in this process
+    CoSimIO::Info settings_partner(settings);
+    settings_partner.Set<std::string>("trace_file", "trace_test_partner");
+    settings_partner.Set<std::string>("my_name", "thread");
+    settings_partner.Set<std::string>("connect_to", "main");
+    settings_partner.Set<bool>("is_primary_connection", false);
+
+    settings.Set<std::string>("trace_file", "trace_test_main");
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+
+    std::thread ext_thread([&settings_partner](){
+        using Communication = CoSimIO::Internals::Communication;
+        std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings_partner, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+        // the secondary thread should wait a bit until the primary has created the folder!
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        CoSimIO::Info connect_info;
+        p_comm->Connect(connect_info);
+
+        CoSimIO::Info ctrl_info;
+        ctrl_info.Set<std::string>("identifier", "run_control");
+        for (const std::string& r_control_signal : std::vector<std::string>{"AdvanceInTime", "exit"}) {
+            ctrl_info.Set<std::string>("control_signal", r_control_signal);
+            p_comm->ExportInfo(ctrl_info);
+        }
+
+        CoSimIO::Info disconnect_info;
+        p_comm->Disconnect(disconnect_info);
+    });
+
+    CoSimIO::Internals::Connection connection(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>(), CoSimIO::Internals::CommunicationFactory());
+
+    CoSimIO::Info connect_info;
+    connection.Connect(connect_info);
+
+    int num_calls = 0;
+    connection.Register("AdvanceInTime", [&num_calls](const CoSimIO::Info&){
+        ++num_calls;
+        return CoSimIO::Info();
+    });
+
+    CoSimIO::Info run_info;
+    connection.Run(run_info);
+
+    CoSimIO::Info disconnect_info;
+    connection.Disconnect(disconnect_info);
+
+    ext_thread.join();
+
+    CHECK_EQ(num_calls, 1);
+
+    const std::string trace = ReadAndRemoveTraceFile("trace_test_main_0.json");
+    CheckTraceHasEvents(trace, {"ImportInfo", "deserialize", "wait", "Run"});
+    CHECK_NE(trace.find("\"cat\": \"run\""), std::string::npos);
+    CHECK_NE(trace.find("\"args\": {\"detail\": \"AdvanceInTime\"}"), std::string::npos);
+
+    const std::string trace_partner = ReadAndRemoveTraceFile("trace_test_partner_0.json");
+    CheckTraceHasEvents(trace_partner, {"ExportInfo", "serialize"});
+}
+
+TEST_CASE("Tracer_more_events_than_buffered")
+{
+    const fs::path trace_file_name("trace_test_buffered.json");
+    const std::size_t num_events = 2*CoSimIO::Internals::Tracer::MaxBufferedEvents + 5;
+
+    CoSimIO::Internals::Tracer tracer(trace_file_name, "buffered");
+    const auto start_time(std::chrono::steady_clock::now());
+    for (std::size_t i=0; i<num_events; ++i) {
+        tracer.AddEvent("event", "phase", "", start_time, std::chrono::steady_clock::now());
+    }
+    tracer.WriteFile();
+
+    // events added after completing the file are ignored
+    tracer.AddEvent("event", "phase", "", start_time, std::chrono::steady_clock::now());
+    tracer.WriteFile();
+
+    const std::string trace = ReadAndRemoveTraceFile(trace_file_name);
+
+    std::size_t num_events_in_file = 0;
+    for (std::size_t pos = trace.find("{\"name\": \"event\", "); pos != std::string::npos; pos = trace.find("{\"name\": \"event\", ", pos+1)) {
+        ++num_events_in_file;
+    }
+    CHECK_EQ(num_events_in_file, num_events);
+
+    const std::string file_end("}\n]}\n");
+    REQUIRE_GE(trace.size(), file_end.size());
+    CHECK_EQ(trace.substr(trace.size()-file_end.size()), file_end);
+}
+
 TEST_CASE("PipeCommunication" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -643,6 +1118,47 @@ TEST_CASE("PipeCommunication_serializer_data" * doctest::timeout(250))
 #endif
 }
 
+TEST_CASE("PipeCommunication_large_buffer" * doctest::timeout(250))
+{
+    // larger than what the pipes can be resized to, hence the chunks have to be adapted to the actual size of the pipes
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "pipe");
+    settings.Set<int>("buffer_size", 16*1024*1024);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // pipe comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("PipeCommunication_vmsplice" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "pipe");
+    settings.Set<bool>("use_vmsplice", true);
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX // vmsplice is only available in Linux
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("SharedMemoryCommunication" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shm");
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shm comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("SharedMemoryCommunication_small_buffer" * doctest::timeout(250))
+{
+    // data is larger than the buffer, hence it has to be exchanged in chunks
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "shm");
+    settings.Set<std::size_t>("buffer_size", 128);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // shm comm is currenlty not implemented in Win
+    RunAllCommunication(settings);
+#endif
+}
+
 TEST_CASE("LocalSocketCommunication" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -662,6 +1178,26 @@ TEST_CASE("LocalSocketCommunication_serializer_data" * doctest::timeout(250))
 #endif
 }
 
+TEST_CASE("LocalSocketCommunication_async_io" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "local_socket");
+    settings.Set<bool>("use_async_io", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // some debugging is needed to make it work in Win
+    RunAllCommunication(settings);
+#endif
+}
+
+TEST_CASE("LocalSocketCommunication_auto_tune_buffers" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "local_socket");
+    settings.Set<bool>("auto_tune_buffers", true);
+#ifndef CO_SIM_IO_COMPILED_IN_WINDOWS // some debugging is needed to make it work in Win
+    RunAllCommunication(settings);
+#endif
+}
+
 TEST_CASE("SocketCommunication" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
@@ -669,6 +1205,88 @@ TEST_CASE("SocketCommunication" * doctest::timeout(250))
     RunAllCommunication(settings);
 }
 
+TEST_CASE("SocketCommunication_socket_options" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("tcp_nodelay", false);
+    settings.Set<int>("socket_send_buffer_size", 1048576);
+    settings.Set<int>("socket_receive_buffer_size", 1048576);
+#ifdef CO_SIM_IO_COMPILED_IN_LINUX // busy polling is only available in Linux
+    settings.Set<int>("busy_poll", 50);
+#endif
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_auto_tune_buffers" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("auto_tune_buffers", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_auto_tune_buffers_connect_info" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("auto_tune_buffers", true);
+    settings.Set<std::string>("my_name", "main");
+    settings.Set<std::string>("connect_to", "thread");
+    settings.Set<bool>("is_primary_connection", true);
+    settings.Set<int>("echo_level", 0);
+
+    using Communication = CoSimIO::Internals::Communication;
+    std::unique_ptr<Communication> p_comm = CoSimIO::Internals::CommunicationFactory().Create(settings, std::make_shared<CoSimIO::Internals::DataCommunicator>());
+
+    std::thread ext_thread(ConnectDisconnect, settings);
+
+    CoSimIO::Info connect_info;
+    CoSimIO::Info ret_info_connect = p_comm->Connect(connect_info);
+
+    // the values chosen by the probe are reported
+    REQUIRE_UNARY(ret_info_connect.Has("tuned_buffer_size"));
+    CHECK_GT(ret_info_connect.Get<double>("round_trip_time"), 0.0);
+    CHECK_GT(ret_info_connect.Get<double>("bandwidth"), 0.0);
+    CHECK_GE(ret_info_connect.Get<int>("tuned_buffer_size"), 256*1024);
+    // the operating system might limit (or increase) the buffer sizes
+    CHECK_GT(ret_info_connect.Get<int>("socket_send_buffer_size"), 0);
+    CHECK_GT(ret_info_connect.Get<int>("socket_receive_buffer_size"), 0);
+
+    CoSimIO::Info disconnect_info;
+    p_comm->Disconnect(disconnect_info);
+
+    ext_thread.join();
+}
+
+TEST_CASE("SocketCommunication_multiple_streams" * doctest::timeout(250))
+{
+    // small threshold such that also small data is striped across the sockets
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<int>("num_streams", 3);
+    settings.Set<std::size_t>("striping_threshold", 16);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_async_io" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("use_async_io", true);
+    RunAllCommunication(settings);
+}
+
+TEST_CASE("SocketCommunication_async_io_serializer_data" * doctest::timeout(250))
+{
+    CoSimIO::Info settings;
+    settings.Set<std::string>("communication_format", "socket");
+    settings.Set<bool>("use_async_io", true);
+    settings.Set<int>("max_queued_messages", 1);
+    settings.Set<bool>("always_use_serializer", true);
+    RunAllCommunication(settings);
+}
+
 TEST_CASE("SocketCommunication_serializer_data" * doctest::timeout(250))
 {
     CoSimIO::Info settings;
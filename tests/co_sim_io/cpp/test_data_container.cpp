@@ -353,6 +353,64 @@ TEST_CASE("DataContainer_serialization_mixed")
     free(load_data);
 }
 
+TEST_CASE("DataContainer_serialization_trace_types")
+{
+    std::vector<double> save_values {
+        1.0, -2.333, 15.88, 14.7, -99.6
+    };
+
+    std::vector<double> load_values;
+
+    CoSimIO::Internals::Serializer::TraceType trace_type;
+
+    SUBCASE("no_trace")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_NO_TRACE;
+    }
+    SUBCASE("trace_error")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_TRACE_ERROR;
+    }
+    SUBCASE("trace_all")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_TRACE_ALL;
+    }
+    SUBCASE("ascii")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_ASCII;
+    }
+
+    const DataContainerBasePointer p_save_container(CoSimIO::make_unique<DataContainerStdVectorReadOnly<double>>(save_values));
+    DataContainerBasePointer p_load_container(CoSimIO::make_unique<DataContainerStdVector<double>>(load_values));
+
+    CoSimIO::Internals::StreamSerializer serializer(trace_type);
+    serializer.save("container", *p_save_container);
+    serializer.load("container", *p_load_container);
+
+    CO_SIM_IO_CHECK_VECTOR_NEAR(save_values, load_values);
+}
+
+TEST_CASE("DataContainer_serialization_binary_format")
+{
+    // the values are saved as one block, which must give the same result as saving them one by one
+    std::vector<double> values {
+        1.0, -2.333, 15.88, 14.7, -99.6
+    };
+
+    const DataContainerBasePointer p_container(CoSimIO::make_unique<DataContainerStdVectorReadOnly<double>>(values));
+
+    CoSimIO::Internals::StreamSerializer serializer_container;
+    serializer_container.save("container", *p_container);
+
+    CoSimIO::Internals::StreamSerializer serializer_values;
+    serializer_values.save("size", values.size());
+    for (const double value : values) {
+        serializer_values.save("v", value);
+    }
+
+    CHECK_EQ(serializer_container.GetStringRepresentation(), serializer_values.GetStringRepresentation());
+}
+
 } // TEST_SUITE("DataContainer")
 
 } // namespace Internals
@@ -0,0 +1,131 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+
+// Project includes
+#include "co_sim_io_testing.hpp"
+#include "includes/model_part.hpp"
+#include "includes/mesh_codec.hpp"
+#include "includes/stream_serializer.hpp"
+
+
+namespace CoSimIO {
+
+namespace {
+
+void SaveAndLoadWithMeshCodec(
+    const ModelPart& rModelPartSave,
+    ModelPart& rModelPartLoad,
+    const Internals::Serializer::TraceType Trace=Internals::Serializer::TraceType::SERIALIZER_NO_TRACE)
+{
+    Internals::StreamSerializer serializer(Trace);
+    serializer.save("model_part", Internals::MeshCodec(rModelPartSave));
+
+    Internals::MeshCodec mesh_codec(rModelPartLoad);
+    serializer.load("model_part", mesh_codec);
+}
+
+}
+
+TEST_SUITE("MeshCodec") {
+
+TEST_CASE("mesh_codec_empty")
+{
+    ModelPart model_part_save("for_test");
+    ModelPart model_part_load("for_test");
+
+    SaveAndLoadWithMeshCodec(model_part_save, model_part_load);
+
+    CheckModelPartsAreEqual(model_part_save, model_part_load);
+}
+
+TEST_CASE("mesh_codec_nodes_and_elements")
+{
+    ModelPart model_part_save("for_test");
+    ModelPart model_part_load("for_test");
+
+    Internals::Serializer::TraceType trace_type;
+
+    SUBCASE("no_trace")
+    {
+        trace_type = Internals::Serializer::TraceType::SERIALIZER_NO_TRACE;
+    }
+    SUBCASE("trace_error")
+    {
+        trace_type = Internals::Serializer::TraceType::SERIALIZER_TRACE_ERROR;
+    }
+    SUBCASE("ascii")
+    {
+        trace_type = Internals::Serializer::TraceType::SERIALIZER_ASCII;
+    }
+
+    const int node_ids[] = {2, 159, 61, 1996};
+    const std::array<double, 3> node_coords = {1.0, -2.7, 9.44};
+    model_part_save.CreateNewNode(node_ids[0], node_coords[0], node_coords[1], node_coords[2]);
+    model_part_save.CreateNewNode(node_ids[1], node_coords[1], node_coords[2], node_coords[0]);
+    model_part_save.CreateNewNode(node_ids[2], node_coords[2], node_coords[0], node_coords[1]);
+    model_part_save.CreateNewNode(node_ids[3], node_coords[2], node_coords[1], node_coords[0]);
+
+    model_part_save.CreateNewElement(15, CoSimIO::ElementType::Point2D, {node_ids[0]});
+    model_part_save.CreateNewElement(73, CoSimIO::ElementType::Line2D2, {node_ids[1], node_ids[2]});
+    model_part_save.CreateNewElement(47, CoSimIO::ElementType::Triangle3D3, {node_ids[1], node_ids[2], node_ids[0]});
+    model_part_save.CreateNewElement(3, CoSimIO::ElementType::Quadrilateral2D4, {node_ids[3], node_ids[1], node_ids[2], node_ids[0]});
+
+    SaveAndLoadWithMeshCodec(model_part_save, model_part_load, trace_type);
+
+    CheckModelPartsAreEqual(model_part_save, model_part_load);
+}
+
+TEST_CASE("mesh_codec_ghost_nodes")
+{
+    ModelPart model_part_save("for_test");
+    ModelPart model_part_load("for_test");
+
+    // local and ghost nodes are mixed, the order has to be preserved
+    model_part_save.CreateNewNode(1, 0.0, 0.0, 0.0);
+    model_part_save.CreateNewGhostNode(12, 1.0, 0.0, 0.0, 3);
+    model_part_save.CreateNewNode(5, 2.0, 0.0, 0.0);
+    model_part_save.CreateNewGhostNode(7, 3.0, 1.0, 0.0, 0);
+    model_part_save.CreateNewGhostNode(8, 3.0, 1.0, 5.0, 3);
+
+    model_part_save.CreateNewElement(1, CoSimIO::ElementType::Line2D2, {1, 12});
+    model_part_save.CreateNewElement(2, CoSimIO::ElementType::Triangle3D3, {5, 7, 8});
+
+    SaveAndLoadWithMeshCodec(model_part_save, model_part_load);
+
+    CheckModelPartsAreEqual(model_part_save, model_part_load);
+}
+
+TEST_CASE("mesh_codec_load_into_non_empty")
+{
+    ModelPart model_part_save("for_test");
+    ModelPart model_part_load("for_test");
+
+    model_part_save.CreateNewNode(1, 0.0, 0.0, 0.0);
+    model_part_save.CreateNewNode(2, 1.0, 0.0, 0.0);
+    model_part_save.CreateNewElement(1, CoSimIO::ElementType::Line2D2, {1, 2});
+
+    // existing entities are removed when loading
+    model_part_load.CreateNewNode(1, 5.0, 5.0, 5.0);
+    model_part_load.CreateNewNode(3, 1.0, 0.0, 0.0);
+    model_part_load.CreateNewGhostNode(4, 1.0, 0.0, 0.0, 2);
+    model_part_load.CreateNewElement(1, CoSimIO::ElementType::Line2D2, {1, 3});
+
+    SaveAndLoadWithMeshCodec(model_part_save, model_part_load);
+
+    CheckModelPartsAreEqual(model_part_save, model_part_load);
+}
+
+} // TEST_SUITE("MeshCodec")
+
+} // namespace CoSimIO
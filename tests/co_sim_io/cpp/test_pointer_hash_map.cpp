@@ -0,0 +1,113 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+
+// Project includes
+#include "co_sim_io_testing.hpp"
+#include "includes/pointer_hash_map.hpp"
+
+
+namespace CoSimIO {
+
+TEST_SUITE("PointerHashMap") {
+
+TEST_CASE("PointerHashMap_empty")
+{
+    Internals::PointerHashMap<int> hash_map;
+    int value = 5;
+
+    CHECK(hash_map.empty());
+    CHECK_EQ(hash_map.size(), 0);
+    CHECK_EQ(hash_map.find(&value), nullptr);
+}
+
+TEST_CASE("PointerHashMap_insert_find")
+{
+    Internals::PointerHashMap<int> hash_map;
+    int values[3] = {1, 2, 3};
+
+    CHECK(hash_map.insert(&values[0], 10));
+    CHECK(hash_map.insert(&values[1], 20));
+
+    CHECK_FALSE(hash_map.empty());
+    CHECK_EQ(hash_map.size(), 2);
+
+    REQUIRE_NE(hash_map.find(&values[0]), nullptr);
+    REQUIRE_NE(hash_map.find(&values[1]), nullptr);
+    CHECK_EQ(*hash_map.find(&values[0]), 10);
+    CHECK_EQ(*hash_map.find(&values[1]), 20);
+    CHECK_EQ(hash_map.find(&values[2]), nullptr);
+
+    // existing keys are not overwritten
+    CHECK_FALSE(hash_map.insert(&values[0], 30));
+    CHECK_EQ(hash_map.size(), 2);
+    CHECK_EQ(*hash_map.find(&values[0]), 10);
+
+    // values can be modified
+    *hash_map.find(&values[1]) = 25;
+    CHECK_EQ(*hash_map.find(&values[1]), 25);
+}
+
+TEST_CASE("PointerHashMap_many_entries")
+{
+    // more entries than the initial capacity, to check the rehashing
+    const std::size_t num_values = 10000;
+    std::vector<double> values(num_values);
+
+    Internals::PointerHashMap<std::size_t> hash_map;
+
+    SUBCASE("without_reserve")
+    {
+    }
+    SUBCASE("with_reserve")
+    {
+        hash_map.reserve(num_values);
+    }
+
+    for (std::size_t i=0; i<num_values; ++i) {
+        CHECK(hash_map.insert(&values[i], i));
+    }
+
+    CHECK_EQ(hash_map.size(), num_values);
+
+    for (std::size_t i=0; i<num_values; ++i) {
+        REQUIRE_NE(hash_map.find(&values[i]), nullptr);
+        CHECK_EQ(*hash_map.find(&values[i]), i);
+    }
+
+    double other_value = 1.0;
+    CHECK_EQ(hash_map.find(&other_value), nullptr);
+}
+
+TEST_CASE("PointerHashMap_clear")
+{
+    Internals::PointerHashMap<bool> hash_map;
+    int values[2] = {1, 2};
+
+    hash_map.insert(&values[0], true);
+    hash_map.insert(&values[1], true);
+    CHECK_EQ(hash_map.size(), 2);
+
+    hash_map.clear();
+
+    CHECK(hash_map.empty());
+    CHECK_EQ(hash_map.find(&values[0]), nullptr);
+
+    CHECK(hash_map.insert(&values[0], true));
+    CHECK_EQ(hash_map.size(), 1);
+}
+
+} // TEST_SUITE("PointerHashMap")
+
+} // namespace CoSimIO
@@ -427,6 +427,41 @@ void RunAllSerializationTests(CoSimIO::Internals::Serializer& rSerializer)
         TestObjectSerializationComponentwise1D(rSerializer, object_to_be_saved, object_to_be_loaded);
     }
 
+    SUBCASE("contiguous_int")
+    {
+        std::vector<int> object_to_be_saved(15);
+        std::vector<int> object_to_be_loaded(object_to_be_saved.size());
+
+        FillVectorWithValues(object_to_be_saved);
+
+        rSerializer.save_contiguous("contiguous", object_to_be_saved.data(), object_to_be_saved.size());
+        rSerializer.load_contiguous("contiguous", object_to_be_loaded.data(), object_to_be_loaded.size());
+
+        CHECK_EQ(object_to_be_saved, object_to_be_loaded);
+    }
+
+    SUBCASE("contiguous_double")
+    {
+        std::vector<double> object_to_be_saved(15);
+        std::vector<double> object_to_be_loaded(object_to_be_saved.size());
+
+        FillVectorWithValues(object_to_be_saved);
+
+        rSerializer.save_contiguous("contiguous", object_to_be_saved.data(), object_to_be_saved.size());
+        rSerializer.load_contiguous("contiguous", object_to_be_loaded.data(), object_to_be_loaded.size());
+
+        CO_SIM_IO_CHECK_VECTOR_NEAR(object_to_be_saved, object_to_be_loaded);
+    }
+
+    SUBCASE("std::vector_string")
+    {
+        // not contiguously serializable, the values are saved one by one
+        std::vector<std::string> object_to_be_saved {"abc", "", "my_string", "x"};
+        std::vector<std::string> object_to_be_loaded;
+
+        TestObjectSerialization(rSerializer, object_to_be_saved, object_to_be_loaded);
+    }
+
     SUBCASE("std::map")
     {
         std::map <std::string, double> object_to_be_saved {
@@ -528,6 +563,98 @@ TEST_CASE("Serializer_ascii")
     RunAllSerializationTests(serializer);
 }
 
+TEST_CASE("Serializer_vector_binary_format")
+{
+    // vectors of arithmetic types are saved as one block, which must give the same result as saving the values one by one
+    std::vector<CoSimIO::IdType> values {1, 5, 8, -3, 123456789};
+
+    CoSimIO::Internals::StreamSerializer serializer_vector;
+    serializer_vector.save("vector", values);
+
+    CoSimIO::Internals::StreamSerializer serializer_values;
+    serializer_values.save("size", values.size());
+    for (const auto value : values) {
+        serializer_values.save("E", value);
+    }
+
+    CHECK_EQ(serializer_vector.GetStringRepresentation(), serializer_values.GetStringRepresentation());
+}
+
+TEST_CASE("StreamSerializer_load_from_data")
+{
+    CoSimIO::Internals::Serializer::TraceType trace_type;
+
+    SUBCASE("no_trace")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_NO_TRACE;
+    }
+    SUBCASE("trace_error")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_TRACE_ERROR;
+    }
+    SUBCASE("ascii")
+    {
+        trace_type = CoSimIO::Internals::Serializer::TraceType::SERIALIZER_ASCII;
+    }
+
+    // large enough for the buffer to grow multiple times
+    std::vector<double> values_save(100000);
+    for (std::size_t i=0; i<values_save.size(); ++i) {
+        values_save[i] = i*1.25;
+    }
+    const std::string string_save("some_string");
+
+    CoSimIO::Internals::StreamSerializer serializer_save(trace_type);
+    serializer_save.save("values", values_save);
+    serializer_save.save("string", string_save);
+    const std::string data = serializer_save.GetStringRepresentation();
+
+    auto check_load = [&](CoSimIO::Internals::StreamSerializer& rSerializer){
+        std::vector<double> values_load;
+        std::string string_load;
+        rSerializer.load("values", values_load);
+        rSerializer.load("string", string_load);
+        CHECK_EQ(values_save, values_load);
+        CHECK_EQ(string_save, string_load);
+    };
+
+    // from string, the data is not copied
+    CoSimIO::Internals::StreamSerializer serializer_string(data, trace_type);
+    check_load(serializer_string);
+
+    // from moved string
+    std::string data_copy(data);
+    CoSimIO::Internals::StreamSerializer serializer_moved_string(std::move(data_copy), trace_type);
+    check_load(serializer_moved_string);
+
+    // from pointer and size, the data is not copied
+    CoSimIO::Internals::StreamSerializer serializer_pointer(data.data(), data.size(), trace_type);
+    check_load(serializer_pointer);
+}
+
+TEST_CASE("StreamSerializer_get_and_extract_string_representation")
+{
+    CoSimIO::Internals::StreamSerializer serializer;
+    serializer.save("value_1", 15);
+    const std::string data_1 = serializer.GetStringRepresentation();
+    CHECK_EQ(data_1.size(), sizeof(int));
+
+    // saving is possible after getting the data
+    serializer.save("value_2", 26);
+    CHECK_EQ(serializer.GetStringRepresentation().size(), 2*sizeof(int));
+
+    const std::string data_2 = serializer.ExtractStringRepresentation();
+    CHECK_EQ(data_2.size(), 2*sizeof(int));
+    CHECK(serializer.GetStringRepresentation().empty());
+
+    int value_1, value_2;
+    CoSimIO::Internals::StreamSerializer serializer_load(data_2);
+    serializer_load.load("value_1", value_1);
+    serializer_load.load("value_2", value_2);
+    CHECK_EQ(value_1, 15);
+    CHECK_EQ(value_2, 26);
+}
+
 } // TEST_SUITE("Serializer")
 
 } // namespace CoSimIO
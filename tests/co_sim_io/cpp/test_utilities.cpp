@@ -11,6 +11,8 @@
 //
 
 // System includes
+#include <thread>
+#include <fstream>
 
 // Project includes
 #include "co_sim_io_testing.hpp"
@@ -935,6 +937,44 @@ TEST_CASE("ComputePartnerRanksAsExporter")
     CHECK_EQ(exp_partner_ranks, neighbor_ranks);
 }
 
+TEST_CASE("FileWaitStrategy_conversion")
+{
+    for (const std::string& r_name : std::vector<std::string>{"polling", "backoff", "inotify"}) {
+        CHECK_EQ(Utilities::FileWaitStrategyToString(Utilities::StringToFileWaitStrategy(r_name)), r_name);
+    }
+
+    CHECK_THROWS_WITH(Utilities::StringToFileWaitStrategy("abc"), doctest::Contains("Invalid file_wait_strategy"));
+}
+
+TEST_CASE("WaitUntilPathExists_WaitUntilPathIsRemoved" * doctest::timeout(20))
+{
+    const fs::path file_name("test_wait_for_path.dat");
+    fs::remove(file_name);
+
+    for (const std::string& r_name : std::vector<std::string>{"polling", "backoff", "inotify"}) {
+        CAPTURE(r_name);
+        const Utilities::FileWaitStrategy strategy = Utilities::StringToFileWaitStrategy(r_name);
+
+        std::thread create_thread([&file_name](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::ofstream output_file(file_name);
+        });
+
+        Utilities::WaitUntilPathExists(file_name, strategy);
+        create_thread.join();
+        CHECK(fs::exists(file_name));
+
+        std::thread remove_thread([&file_name](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            fs::remove(file_name);
+        });
+
+        Utilities::WaitUntilPathIsRemoved(file_name, strategy);
+        remove_thread.join();
+        CHECK_FALSE(fs::exists(file_name));
+    }
+}
+
 } // TEST_SUITE("Utilities")
 
 } // namespace CoSimIO
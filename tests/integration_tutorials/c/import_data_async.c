@@ -0,0 +1,99 @@
+/*   ______     _____ _           ________
+    / ____/___ / ___/(_)___ ___  /  _/ __ |
+   / /   / __ \\__ \/ / __ `__ \ / // / / /
+  / /___/ /_/ /__/ / / / / / / // // /_/ /
+  \____/\____/____/_/_/ /_/ /_/___/\____/
+  Kratos CoSimulationApplication
+
+  License:         BSD License, see license.txt
+
+  Main authors:    Pooyan Dadvand
+*/
+
+/* CoSimulation includes */
+#include "c/co_sim_io_c.h"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        printf("in line %d : %d is not equalt to %d\n", __LINE__ , a, b); \
+        return 1;                                                \
+    }
+
+int main()
+{
+    /* declaring variables */
+    CoSimIO_Info connection_settings, connect_info, import_settings, import_request, test_info, import_info, statistics_settings, statistics, identifier_statistics, operation_statistics, disconnect_settings, disconnect_info;
+    const char* connection_name;
+    double* data;
+    int data_allocated_size = 0;
+    int i;
+
+    /* Creating the connection settings */
+    connection_settings=CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(connection_settings, "my_name", "c_import_data_async");
+    CoSimIO_Info_SetString(connection_settings, "connect_to", "c_export_data_async");
+    CoSimIO_Info_SetInt(connection_settings, "echo_level", 1);
+    CoSimIO_Info_SetString(connection_settings, "version", "1.25");
+
+    /* Connecting using the connection settings */
+    connect_info = CoSimIO_Connect(connection_settings);
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(connect_info, "connection_status"), CoSimIO_Connected);
+    connection_name = CoSimIO_Info_GetString(connect_info, "connection_name");
+
+    /* After conneting we may import the data */
+
+    /* Creating the import_settings */
+    import_settings=CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(import_settings, "identifier", "vector_of_pi");
+    CoSimIO_Info_SetString(import_settings, "connection_name", connection_name);
+
+    /* Starting the import, the function returns immediately */
+    import_request = CoSimIO_ImportDataAsync(import_settings, &data_allocated_size, &data);
+
+    /* Here computations could be done while the data is imported */
+    test_info = CoSimIO_Test(import_request);
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_Has(test_info, "is_completed"), 1);
+    CoSimIO_FreeInfo(test_info);
+
+    /* Completing the import, afterwards the data can be used */
+    import_info = CoSimIO_Wait(import_request);
+    COSIMIO_CHECK_EQUAL(data_allocated_size, 4);
+    for (i=0; i<data_allocated_size; ++i) {
+        COSIMIO_CHECK_EQUAL((int)(data[i]*100), 314);
+    }
+
+    /* The accumulated statistics of the operations are available per identifier and operation */
+    statistics_settings=CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(statistics_settings, "connection_name", connection_name);
+    statistics = CoSimIO_GetPerformanceStatistics(statistics_settings);
+    identifier_statistics = CoSimIO_Info_GetInfo(statistics, "vector_of_pi");
+    operation_statistics = CoSimIO_Info_GetInfo(identifier_statistics, "import_data_async");
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(operation_statistics, "count"), 1);
+    COSIMIO_CHECK_EQUAL((CoSimIO_Info_GetDouble(operation_statistics, "bytes") > 0.0), 1);
+    CoSimIO_FreeInfo(operation_statistics);
+    CoSimIO_FreeInfo(identifier_statistics);
+    CoSimIO_FreeInfo(statistics);
+    CoSimIO_FreeInfo(statistics_settings);
+
+    /* Freeing the import_info, import_request and import_settings */
+    CoSimIO_FreeInfo(import_info);
+    CoSimIO_FreeInfo(import_request);
+    CoSimIO_FreeInfo(import_settings);
+
+    /* Freeing the data using CoSimIO_Free. (Not the standard free()) */
+    CoSimIO_Free(data);
+
+    /* Disconnecting at the end */
+    disconnect_settings=CoSimIO_CreateInfo();
+    CoSimIO_Info_SetString(disconnect_settings, "connection_name", connection_name);
+    disconnect_info = CoSimIO_Disconnect(disconnect_settings); /* disconnect afterwards */
+    COSIMIO_CHECK_EQUAL(CoSimIO_Info_GetInt(disconnect_info, "connection_status"), CoSimIO_Disconnected);
+
+    /* Don't forget to release the settings and info */
+    CoSimIO_FreeInfo(connection_settings);
+    CoSimIO_FreeInfo(disconnect_settings);
+    CoSimIO_FreeInfo(connect_info); /* Don't forget to free the connect_info */
+    CoSimIO_FreeInfo(disconnect_info);
+
+    return 0;
+}
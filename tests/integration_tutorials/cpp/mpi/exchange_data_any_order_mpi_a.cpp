@@ -0,0 +1,79 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+// this solver exports several fields at once, its partner ("exchange_data_any_order_mpi_b") imports them in the reversed order
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_any_order_solver_a");
+    settings.Set("connect_to", "cpp_any_order_solver_b");
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+    settings.Set("communication_format", "mpi_inter");
+#endif
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    const std::vector<std::string> identifiers {"pressure", "displacement", "temperature"};
+
+    std::vector<std::vector<double>> data_to_send;
+    for (std::size_t i=0; i<identifiers.size(); ++i) {
+        data_to_send.push_back(std::vector<double>((i+1)*(rank+2), i+0.5*rank));
+    }
+
+    // all fields are in flight at the same time
+    std::vector<CoSimIO::Info> export_requests;
+    for (std::size_t i=0; i<identifiers.size(); ++i) {
+        info.Clear();
+        info.Set("identifier", identifiers[i]);
+        info.Set("connection_name", connection_name);
+        export_requests.push_back(CoSimIO::ExportDataAsync(info, data_to_send[i]));
+    }
+
+    for (const auto& r_request : export_requests) {
+        CoSimIO::Wait(r_request);
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
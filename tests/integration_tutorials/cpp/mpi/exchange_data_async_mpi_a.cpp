@@ -0,0 +1,80 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_async_solver_a");
+    settings.Set("connect_to", "cpp_async_solver_b");
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+    settings.Set("communication_format", "mpi_inter");
+#endif
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    // both partners start with importing, this only works because the import is not blocking
+    std::vector<double> receive_data;
+    info.Clear();
+    info.Set("identifier", "data_from_b");
+    info.Set("connection_name", connection_name);
+    const CoSimIO::Info import_request = CoSimIO::ImportDataAsync(info, receive_data);
+
+    const std::vector<double> data_to_send(rank+3, 1.5*(rank+1));
+    info.Clear();
+    info.Set("identifier", "data_from_a");
+    info.Set("connection_name", connection_name);
+    const CoSimIO::Info export_request = CoSimIO::ExportDataAsync(info, data_to_send);
+
+    CoSimIO::Wait(export_request);
+    CoSimIO::Wait(import_request);
+
+    COSIMIO_CHECK_EQUAL(static_cast<int>(receive_data.size()), rank+3);
+
+    for(auto& value : receive_data)
+        COSIMIO_CHECK_EQUAL(value, 2.5*(rank+1));
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+// this solver exchanges data of changing sizes repeatedly with its partner ("exchange_data_repeated_mpi_a")
+// the name of the option of the MPI communication that is enabled is passed as command line argument
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_repeated_solver_b");
+    settings.Set("connect_to", "cpp_repeated_solver_a");
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+    settings.Set("communication_format", "mpi_inter");
+#endif
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+    settings.Set(std::string(argv[1]), true);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    // the data grows, shrinks and is empty in between
+    const std::vector<std::size_t> sizes {3, 3, 0, 10, 4, 10, 25, 1, 25, 25};
+
+    std::vector<double> receive_data;
+
+    for (std::size_t i=0; i<2*sizes.size(); ++i) {
+        const std::size_t data_size = sizes[i%sizes.size()]*(rank+1);
+
+        // both partners export first
+        std::vector<double> data_to_send(data_size);
+        for (std::size_t j=0; j<data_size; ++j) {
+            data_to_send[j] = -(i*1000.0 + j + rank*0.5);
+        }
+        info.Clear();
+        info.Set("identifier", "data_b");
+        info.Set("connection_name", connection_name);
+        CoSimIO::ExportData(info, data_to_send);
+
+        info.Clear();
+        info.Set("identifier", "data_a");
+        info.Set("connection_name", connection_name);
+        CoSimIO::ImportData(info, receive_data);
+
+        COSIMIO_CHECK_EQUAL(receive_data.size(), data_size);
+        for (std::size_t j=0; j<data_size; ++j) {
+            COSIMIO_CHECK_EQUAL(receive_data[j], (i*1000.0 + j + rank*0.5));
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+// this solver exchanges data with one-sided communication (use_rma) with its partner ("exchange_data_rma_mpi_b")
+// the data grows several times, such that it is sent directly and the importer attaches a larger buffer,
+// afterwards it shrinks again, such that the larger buffers are reused
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_rma_solver_a");
+    settings.Set("connect_to", "cpp_rma_solver_b");
+#ifdef CO_SIM_IO_BUILD_MPI_COMMUNICATION
+    settings.Set("communication_format", "mpi_inter");
+#endif
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+    settings.Set("use_rma", true);
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    const std::vector<std::size_t> sizes {1, 2, 2, 100, 50, 100, 100000, 3, 0, 100000, 100001, 7};
+    const std::vector<std::string> identifiers {"data_1", "data_2"};
+
+    std::vector<double> receive_data;
+
+    for (std::size_t i=0; i<sizes.size(); ++i) {
+        // two identifiers, such that each of them has its own buffer
+        for (std::size_t k=0; k<identifiers.size(); ++k) {
+            const std::size_t data_size = sizes[i]*(rank+1)+k;
+            std::vector<double> data_to_send(data_size);
+            for (std::size_t j=0; j<data_size; ++j) {
+                data_to_send[j] = (i*1000.0 + k*100.0 + j + rank*0.5);
+            }
+            info.Clear();
+            info.Set("identifier", identifiers[k]);
+            info.Set("connection_name", connection_name);
+            CoSimIO::ExportData(info, data_to_send);
+        }
+
+        // the partner sends the data back (negated), such that also the other direction is tested
+        const std::size_t data_size = sizes[sizes.size()-1-i]*(rank+1);
+        info.Clear();
+        info.Set("identifier", "data_back");
+        info.Set("connection_name", connection_name);
+        CoSimIO::ImportData(info, receive_data);
+
+        COSIMIO_CHECK_EQUAL(receive_data.size(), data_size);
+        for (std::size_t j=0; j<data_size; ++j) {
+            COSIMIO_CHECK_EQUAL(receive_data[j], -(i*1000.0 + j + rank*0.5));
+        }
+    }
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+// this solver is meant to be run with a different number of processes than its partner ("exchange_m_to_n_mpi_b")
+// the communication format is passed as command line argument
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_m_to_n_solver_a");
+    settings.Set("connect_to", "cpp_m_to_n_solver_b");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    info.Clear();
+    info.Set("identifier", "info_a");
+    info.Set("connection_name", connection_name);
+    info.Set("num_processes", size);
+    CoSimIO::ExportInfo(info);
+
+    // each rank exports a different amount of data, the values encode the rank and the position
+    std::vector<double> data_to_send(rank+1);
+    for (int i=0; i<rank+1; ++i) {
+        data_to_send[i] = rank*100 + i;
+    }
+    info.Clear();
+    info.Set("identifier", "data_a");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportData(info, data_to_send);
+
+    // each rank has three local nodes and a ghost node that is local on the next rank
+    CoSimIO::ModelPart model_part("mp_m_to_n");
+    for (int i=1; i<4; ++i) {
+        model_part.CreateNewNode(3*rank+i, 3*rank+i, 0, 0);
+    }
+    model_part.CreateNewElement(rank+1, CoSimIO::ElementType::Triangle2D3, {3*rank+1, 3*rank+2, 3*rank+3});
+    if (size > 1) {
+        const int next_rank = (rank+1)%size;
+        model_part.CreateNewGhostNode(3*next_rank+1, 3*next_rank+1, 0, 0, next_rank);
+        model_part.CreateNewElement(size+rank+1, CoSimIO::ElementType::Line2D2, {3*rank+3, 3*next_rank+1});
+    }
+    info.Clear();
+    info.Set("identifier", "mesh_a");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportMesh(info, model_part);
+
+    info.Clear();
+    info.Set("identifier", "info_b");
+    info.Set("connection_name", connection_name);
+    const int partner_size = CoSimIO::ImportInfo(info).Get<int>("num_processes");
+
+    std::vector<double> receive_data;
+    info.Clear();
+    info.Set("identifier", "data_b");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportData(info, receive_data);
+
+    // all data of the partner has to be received exactly once
+    int local_size = static_cast<int>(receive_data.size());
+    int global_size;
+    MPI_Allreduce(&local_size, &global_size, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(global_size, partner_size*(partner_size+1)/2);
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}
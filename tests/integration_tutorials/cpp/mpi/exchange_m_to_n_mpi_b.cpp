@@ -0,0 +1,118 @@
+//     ______     _____ _           ________
+//    / ____/___ / ___/(_)___ ___  /  _/ __ |
+//   / /   / __ \\__ \/ / __ `__ \ / // / / /
+//  / /___/ /_/ /__/ / / / / / / // // /_/ /
+//  \____/\____/____/_/_/ /_/ /_/___/\____/
+//  Kratos CoSimulationApplication
+//
+//  License:         BSD License, see license.txt
+//
+//  Main authors:    Philipp Bucher (https://github.com/philbucher)
+//
+
+// System includes
+#include <vector>
+#include <string>
+
+// External includes
+#include "mpi.h"
+
+// CoSimulation includes
+#include "co_sim_io_mpi.hpp"
+
+#define COSIMIO_CHECK_EQUAL(a, b)                                \
+    if (a != b) {                                                \
+        std::cout << "in line " << __LINE__ << " : " << a        \
+                  << " is not equal to " << b << std::endl;      \
+        return 1;                                                \
+    }
+
+// this solver is meant to be run with a different number of processes than its partner ("exchange_m_to_n_mpi_a")
+// the communication format is passed as command line argument
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv); // needs to be done before calling CoSimIO::ConnectMPI
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    CoSimIO::Info settings;
+    settings.Set("my_name", "cpp_m_to_n_solver_b");
+    settings.Set("connect_to", "cpp_m_to_n_solver_a");
+    settings.Set("communication_format", std::string(argv[1]));
+    settings.Set("echo_level", 1);
+    settings.Set("version", "1.25");
+
+    auto info = CoSimIO::ConnectMPI(settings, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Connected);
+    const std::string connection_name = info.Get<std::string>("connection_name");
+
+    // the Info is available on all ranks, also on the ones that don't import data
+    info.Clear();
+    info.Set("identifier", "info_a");
+    info.Set("connection_name", connection_name);
+    const int partner_size = CoSimIO::ImportInfo(info).Get<int>("num_processes");
+
+    std::vector<double> receive_data;
+    info.Clear();
+    info.Set("identifier", "data_a");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportData(info, receive_data);
+
+    // the data of the partner ranks is concatenated in the order of the partner ranks
+    int previous_partner_rank = -1;
+    std::size_t pos = 0;
+    while (pos < receive_data.size()) {
+        const int partner_rank = static_cast<int>(receive_data[pos])/100;
+        COSIMIO_CHECK_EQUAL((partner_rank > previous_partner_rank), true);
+        for (int i=0; i<partner_rank+1; ++i) {
+            COSIMIO_CHECK_EQUAL(receive_data[pos++], partner_rank*100 + i);
+        }
+        previous_partner_rank = partner_rank;
+    }
+
+    int local_size = static_cast<int>(receive_data.size());
+    int global_size;
+    MPI_Allreduce(&local_size, &global_size, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(global_size, partner_size*(partner_size+1)/2);
+
+    CoSimIO::ModelPart model_part("mp_m_to_n");
+    info.Clear();
+    info.Set("identifier", "mesh_a");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ImportMesh(info, model_part);
+
+    // every node is local on exactly one rank, the ghost nodes refer to the ranks of this solver
+    int local_counts[2] = {static_cast<int>(model_part.NumberOfLocalNodes()), static_cast<int>(model_part.NumberOfElements())};
+    int global_counts[2];
+    MPI_Allreduce(local_counts, global_counts, 2, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    COSIMIO_CHECK_EQUAL(global_counts[0], 3*partner_size);
+    COSIMIO_CHECK_EQUAL(global_counts[1], (partner_size > 1 ? 2*partner_size : 1));
+
+    for (const auto& r_partition : model_part.GetPartitionModelParts()) {
+        COSIMIO_CHECK_EQUAL((r_partition.first >= 0 && r_partition.first < size && r_partition.first != rank), true);
+    }
+
+    info.Clear();
+    info.Set("identifier", "info_b");
+    info.Set("connection_name", connection_name);
+    info.Set("num_processes", size);
+    CoSimIO::ExportInfo(info);
+
+    const std::vector<double> data_to_send(rank+1, rank);
+    info.Clear();
+    info.Set("identifier", "data_b");
+    info.Set("connection_name", connection_name);
+    CoSimIO::ExportData(info, data_to_send);
+
+    CoSimIO::Info disconnect_settings;
+    disconnect_settings.Set("connection_name", connection_name);
+    info = CoSimIO::Disconnect(disconnect_settings); // disconnect afterwards
+    COSIMIO_CHECK_EQUAL(info.Get<int>("connection_status"), CoSimIO::ConnectionStatus::Disconnected);
+
+    MPI_Finalize();
+
+    return 0;
+}